@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <print>
+#include <random>
+#include <toolkit/frustum_cull.h>
+#include <toolkit/math.h>
+#include <vector>
+
+/*
+ * Benchmark Properties
+ */
+const size_t kObjectCount = 1000000;
+// Objects are scattered over a cube this wide, centered on the origin.
+const float kWorldSize = 2000.0;
+const float kMaxRadius = 4.0;
+const int kIterations = 50;
+
+/*
+ * Function Declarations
+ */
+static void FillVolumes(BoundingSpheres* spheres, BoundingBoxes* boxes);
+template <typename Volumes>
+static double MedianMilliseconds(FrustumCuller& culler, const Volumes& volumes,
+                                 const float planes[6][4],
+                                 std::vector<uint32_t>* visible);
+
+int main() {
+  BoundingSpheres spheres;
+  BoundingBoxes boxes;
+  FillVolumes(&spheres, &boxes);
+
+  Mat4 proj = Perspective(1.05, 16.0 / 9.0, 0.1, 800.0);
+  Mat4 view = LookAt({0, 0, 0}, {1, 0.2, 0.5}, {0, 1, 0});
+  float planes[6][4];
+  ExtractFrustumPlanes(proj * view, planes);
+
+  std::println("{} objects, median of {} runs", kObjectCount, kIterations);
+  std::println("{:>8} {:>8} {:>10} {:>10} {:>10}", "path", "threads",
+               "spheres", "boxes", "visible");
+
+  std::vector<uint32_t> reference, visible;
+  FrustumCuller(CullPath::kScalar).Cull(spheres, planes, &reference);
+
+  for (CullPath path :
+       {CullPath::kScalar, CullPath::kAvx2, CullPath::kAvx512}) {
+    if (path > BestCullPath()) break;
+
+    for (bool threaded : {false, true}) {
+      FrustumCuller culler(path);
+      culler.SetThreaded(threaded);
+
+      double sphereMs = MedianMilliseconds(culler, spheres, planes, &visible);
+      if (visible != reference) {
+        std::println(stderr, "{} disagrees with the scalar sphere results.",
+                     CullPathName(path));
+        return 1;
+      }
+      size_t sphereCount = visible.size();
+      double boxMs = MedianMilliseconds(culler, boxes, planes, &visible);
+
+      std::println("{:>8} {:>8} {:>8.3f}ms {:>8.3f}ms {:>10}",
+                   CullPathName(path), threaded ? "all" : "1", sphereMs,
+                   boxMs, sphereCount);
+    }
+  }
+  return 0;
+}
+
+static void FillVolumes(BoundingSpheres* spheres, BoundingBoxes* boxes) {
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> position(-kWorldSize / 2,
+                                                 kWorldSize / 2);
+  std::uniform_real_distribution<float> radius(0.5, kMaxRadius);
+
+  spheres->resize(kObjectCount);
+  boxes->resize(kObjectCount);
+  for (size_t i = 0; i < kObjectCount; i++) {
+    float x = position(rng), y = position(rng), z = position(rng);
+    float r = radius(rng);
+    spheres->x[i] = x;
+    spheres->y[i] = y;
+    spheres->z[i] = z;
+    spheres->radius[i] = r;
+    boxes->minX[i] = x - r;
+    boxes->minY[i] = y - r;
+    boxes->minZ[i] = z - r;
+    boxes->maxX[i] = x + r;
+    boxes->maxY[i] = y + r;
+    boxes->maxZ[i] = z + r;
+  }
+}
+
+template <typename Volumes>
+static double MedianMilliseconds(FrustumCuller& culler, const Volumes& volumes,
+                                 const float planes[6][4],
+                                 std::vector<uint32_t>* visible) {
+  std::vector<double> times;
+  for (int i = 0; i < kIterations; i++) {
+    auto start = std::chrono::steady_clock::now();
+    culler.Cull(volumes, planes, visible);
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    times.push_back(elapsed.count());
+  }
+  std::ranges::sort(times);
+  return times[times.size() / 2];
+}
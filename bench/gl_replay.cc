@@ -0,0 +1,141 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <print>
+#include <string_view>
+#include <toolkit/gl_replay.h>
+#include <toolkit/window.h>
+#include <vector>
+
+/*
+ * Benchmark Properties
+ */
+// Matches the window size of the samples that record captures.
+int gWidth = 800;
+int gHeight = 600;
+// Times the trace is played back; frame times are pooled over all runs.
+int gRuns = 5;
+
+/*
+ * Function Declarations
+ */
+static bool ParseArgs(int argc, char** argv, const char** path,
+                      bool* visible);
+static double Percentile(const std::vector<double>& sorted, double p);
+
+// Replays a trace recorded with --capture in a hidden window with vsync
+// off and reports per-frame CPU+GPU time, so rendering changes can be
+// compared on identical command streams.
+int main(int argc, char** argv) {
+  const char* path = "capture.glc";
+  bool visible = false;
+  if (!ParseArgs(argc, argv, &path, &visible)) {
+    std::println(stderr,
+                 "usage: {} [trace.glc] [--runs N] [--resolution WxH] "
+                 "[--visible]",
+                 argv[0]);
+    return 1;
+  }
+
+  InitGLFW(3, 3, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+  GLFWwindow* window =
+      glfwCreateWindow(gWidth, gHeight, "GL Replay", NULL, NULL);
+  if (window == NULL) {
+    std::println(stderr, "Failed to create GLFW Window.");
+    glfwTerminate();
+    return 1;
+  }
+  glfwMakeContextCurrent(window);
+  if (!InitGLAD()) {
+    std::println(stderr, "Failed to initialize GLAD.");
+    glfwTerminate();
+    return 1;
+  }
+  glfwSwapInterval(0);
+  std::println("Replaying {} on {}", path,
+               reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+
+  // The first frame of each run creates every object, so it is reported
+  // separately from the steady state.
+  std::vector<double> setup, frames;
+  for (int run = 0; run < gRuns; run++) {
+    GLReplayer replayer;
+    if (!replayer.Open(path)) {
+      glfwTerminate();
+      return 1;
+    }
+    while (true) {
+      auto start = std::chrono::steady_clock::now();
+      bool more = replayer.ReplayFrame();
+      glfwSwapBuffers(window);
+      glFinish();
+      std::chrono::duration<double, std::milli> elapsed =
+          std::chrono::steady_clock::now() - start;
+      if (!more) break;
+      (replayer.FramesReplayed() == 1 ? setup : frames)
+          .push_back(elapsed.count());
+      glfwPollEvents();
+    }
+    // Objects left alive by one run would pile up under the next.
+    replayer.Release();
+    if (replayer.Failed()) {
+      glfwTerminate();
+      return 1;
+    }
+  }
+
+  if (frames.empty()) {
+    std::println(stderr, "{} holds fewer than two frames.", path);
+    glfwTerminate();
+    return 1;
+  }
+  std::ranges::sort(setup);
+  std::ranges::sort(frames);
+  double total = 0;
+  for (double ms : frames) total += ms;
+
+  std::println("{} runs, {} frames each", gRuns, frames.size() / gRuns + 1);
+  std::println("first frame  {:8.3f}ms (median)", Percentile(setup, 0.5));
+  std::println("{:>8} {:>8} {:>8} {:>8} {:>8} {:>8}", "min", "median",
+               "p95", "p99", "max", "fps");
+  std::println("{:6.3f}ms {:6.3f}ms {:6.3f}ms {:6.3f}ms {:6.3f}ms {:8.1f}",
+               frames.front(), Percentile(frames, 0.5),
+               Percentile(frames, 0.95), Percentile(frames, 0.99),
+               frames.back(), 1000.0 * frames.size() / total);
+
+  glfwTerminate();
+  return 0;
+}
+
+static bool ParseArgs(int argc, char** argv, const char** path,
+                      bool* visible) {
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "--visible") {
+      *visible = true;
+    } else if (arg == "--runs" && i + 1 < argc) {
+      gRuns = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--resolution" && i + 1 < argc) {
+      if (std::sscanf(argv[++i], "%dx%d", &gWidth, &gHeight) != 2 ||
+          gWidth <= 0 || gHeight <= 0) {
+        return false;
+      }
+    } else if (arg.starts_with("--")) {
+      return false;
+    } else {
+      *path = argv[i];
+    }
+  }
+  return true;
+}
+
+static double Percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(index, sorted.size() - 1)];
+}
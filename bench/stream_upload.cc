@@ -0,0 +1,172 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <print>
+#include <string_view>
+#include <thread>
+#include <toolkit/resource_loader.h>
+#include <toolkit/window.h>
+#include <vector>
+
+/*
+ * Benchmark Properties
+ */
+// Streamed per mode, in buffers of kChunkBytes.
+size_t gTotalBytes = size_t(1) << 30;
+const size_t kChunkBytes = 16 << 20;
+// Uploads the loader may have queued or in flight at once.
+const size_t kMaxPending = 4;
+
+/*
+ * Function Declarations
+ */
+static void Frame(GLFWwindow* window, double time);
+static void Report(const char* mode, std::vector<double>& frames,
+                   double seconds);
+
+// Streams the same data into GL buffers once from the render thread and
+// once through a ResourceLoader, drawing a frame between uploads, and
+// reports how much each way disturbs frame times.
+int main(int argc, char** argv) {
+  bool visible = false;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "--visible") {
+      visible = true;
+    } else if (arg == "--total-mb" && i + 1 < argc) {
+      gTotalBytes = size_t(std::max(1, std::atoi(argv[++i]))) << 20;
+    } else {
+      std::println(stderr, "usage: {} [--total-mb N] [--visible]", argv[0]);
+      return 1;
+    }
+  }
+
+  InitGLFW(3, 3, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+  GLFWwindow* window =
+      glfwCreateWindow(800, 600, "Stream Upload", NULL, NULL);
+  if (window == NULL) {
+    std::println(stderr, "Failed to create GLFW Window.");
+    glfwTerminate();
+    return 1;
+  }
+  glfwMakeContextCurrent(window);
+  if (!InitGLAD()) {
+    std::println(stderr, "Failed to initialize GLAD.");
+    glfwTerminate();
+    return 1;
+  }
+  glfwSwapInterval(0);
+
+  std::vector<unsigned char> chunk(kChunkBytes);
+  for (size_t i = 0; i < chunk.size(); i++) chunk[i] = i * 2654435761u >> 24;
+  size_t chunks = (gTotalBytes + kChunkBytes - 1) / kChunkBytes;
+
+  std::println("Streaming {} MiB in {} MiB buffers", gTotalBytes >> 20,
+               kChunkBytes >> 20);
+  std::println("{:>12} {:>8} {:>9} {:>9} {:>9} {:>10}", "mode", "frames",
+               "median", "p99", "max", "MiB/s");
+
+  // One upload per frame on the render thread.
+  {
+    std::vector<double> frames;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < chunks; i++) {
+      auto frameStart = std::chrono::steady_clock::now();
+      unsigned int buffer;
+      glGenBuffers(1, &buffer);
+      glBindBuffer(GL_ARRAY_BUFFER, buffer);
+      glBufferData(GL_ARRAY_BUFFER, chunk.size(), chunk.data(),
+                   GL_STATIC_DRAW);
+      glBindBuffer(GL_ARRAY_BUFFER, 0);
+      glDeleteBuffers(1, &buffer);
+      Frame(window, i / 60.0);
+      std::chrono::duration<double, std::milli> elapsed =
+          std::chrono::steady_clock::now() - frameStart;
+      frames.push_back(elapsed.count());
+    }
+    std::chrono::duration<double> total =
+        std::chrono::steady_clock::now() - start;
+    Report("render", frames, total.count());
+  }
+
+  // The same uploads through the loader. A producer thread stands in for
+  // asset decoding and keeps a few uploads queued; the render thread
+  // only adopts finished buffers.
+  {
+    ResourceLoader loader;
+    if (!loader.Start(window)) {
+      glfwTerminate();
+      return 1;
+    }
+
+    std::mutex mu;
+    std::deque<UploadId> queued;
+    std::jthread producer([&](std::stop_token stop) {
+      for (size_t i = 0; i < chunks && !stop.stop_requested(); i++) {
+        while (loader.Pending() >= kMaxPending && !stop.stop_requested())
+          std::this_thread::sleep_for(std::chrono::microseconds(200));
+        UploadId id = loader.UploadBuffer(chunk, GL_STATIC_DRAW);
+        std::lock_guard lock(mu);
+        queued.push_back(id);
+      }
+    });
+
+    std::vector<double> frames;
+    auto start = std::chrono::steady_clock::now();
+    size_t adopted = 0;
+    for (int frame = 0; adopted < chunks; frame++) {
+      auto frameStart = std::chrono::steady_clock::now();
+      {
+        std::lock_guard lock(mu);
+        unsigned int buffer;
+        while (!queued.empty() && loader.Adopt(queued.front(), &buffer)) {
+          glDeleteBuffers(1, &buffer);
+          queued.pop_front();
+          adopted++;
+        }
+      }
+      Frame(window, frame / 60.0);
+      std::chrono::duration<double, std::milli> elapsed =
+          std::chrono::steady_clock::now() - frameStart;
+      frames.push_back(elapsed.count());
+    }
+    std::chrono::duration<double> total =
+        std::chrono::steady_clock::now() - start;
+    Report("loader", frames, total.count());
+
+    producer.join();
+    loader.Stop();
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// A light frame: a clear that changes every frame, presented and
+// finished so GPU time is part of the measurement.
+static void Frame(GLFWwindow* window, double time) {
+  glClearColor(0.5 + 0.5 * std::sin(time), 0.2, 0.3, 1.0);
+  glClear(GL_COLOR_BUFFER_BIT);
+  glfwSwapBuffers(window);
+  glFinish();
+  glfwPollEvents();
+}
+
+static void Report(const char* mode, std::vector<double>& frames,
+                   double seconds) {
+  std::ranges::sort(frames);
+  auto at = [&](double p) {
+    return frames[std::min(frames.size() - 1,
+                           static_cast<size_t>(p * frames.size()))];
+  };
+  std::println("{:>12} {:>8} {:7.3f}ms {:7.3f}ms {:7.3f}ms {:10.1f}", mode,
+               frames.size(), at(0.5), at(0.99), frames.back(),
+               (gTotalBytes >> 20) / seconds);
+}
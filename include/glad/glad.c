@@ -7,16 +7,26 @@
     APIs: gl=3.3
     Profile: core
     Extensions:
-        
+        GL_ARB_base_instance
+        GL_ARB_buffer_storage
+        GL_ARB_draw_indirect
+        GL_ARB_get_program_binary
+        GL_ARB_multi_draw_indirect
+        GL_ARB_parallel_shader_compile
+        GL_ARB_timer_query
+        GL_KHR_debug
+        GL_KHR_parallel_shader_compile
     Loader: True
+    Lazy loader: True (gladLoadGLLoaderLazy, added by hand)
+    Extension lookup: hashed table (added by hand)
     Local files: False
     Omit khrplatform: False
     Reproducible: False
 
     Commandline:
-        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions="GL_ARB_base_instance,GL_ARB_buffer_storage,GL_ARB_draw_indirect,GL_ARB_get_program_binary,GL_ARB_multi_draw_indirect,GL_ARB_parallel_shader_compile,GL_ARB_timer_query,GL_KHR_debug,GL_KHR_parallel_shader_compile"
     Online:
-        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+        https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&extensions=GL_ARB_base_instance&extensions=GL_ARB_buffer_storage&extensions=GL_ARB_draw_indirect&extensions=GL_ARB_get_program_binary&extensions=GL_ARB_multi_draw_indirect&extensions=GL_ARB_parallel_shader_compile&extensions=GL_ARB_timer_query&extensions=GL_KHR_debug&extensions=GL_KHR_parallel_shader_compile&api=gl%3D3.3
 */
 
 #include <stdio.h>
@@ -165,96 +175,6 @@ struct gladGLversionStruct GLVersion = { 0, 0 };
 static int max_loaded_major;
 static int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
-
-static int get_exts(void) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-
-        num_exts_i = 0;
-        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
-        }
-
-        if (exts_i == NULL) {
-            return 0;
-        }
-
-        for(index = 0; index < num_exts_i; index++) {
-            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
-        }
-    }
-#endif
-    return 1;
-}
-
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
-}
-
-static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
-
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
-
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
-    }
-#endif
-
-    return 0;
-}
 int GLAD_GL_VERSION_1_0 = 0;
 int GLAD_GL_VERSION_1_1 = 0;
 int GLAD_GL_VERSION_1_2 = 0;
@@ -641,6 +561,39 @@ PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
 PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
 PFNGLVIEWPORTPROC glad_glViewport = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+int GLAD_GL_ARB_buffer_storage = 0;
+int GLAD_GL_ARB_draw_indirect = 0;
+int GLAD_GL_ARB_get_program_binary = 0;
+int GLAD_GL_ARB_multi_draw_indirect = 0;
+int GLAD_GL_ARB_parallel_shader_compile = 0;
+int GLAD_GL_ARB_timer_query = 0;
+int GLAD_GL_KHR_debug = 0;
+int GLAD_GL_KHR_parallel_shader_compile = 0;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
+PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSARBPROC glad_glMaxShaderCompilerThreadsARB = NULL;
+PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
+PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
+PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
+PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
+PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR = NULL;
+int GLAD_GL_ARB_base_instance = 0;
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1054,11 +1007,2222 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_ARB_base_instance(GLADloadproc load) {
+	if(!GLAD_GL_ARB_base_instance) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_ARB_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)load("glMaxShaderCompilerThreadsARB");
+}
+static void load_GL_ARB_timer_query(GLADloadproc load) {
+	if(!GLAD_GL_ARB_timer_query) return;
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+}
+static void load_GL_KHR_debug(GLADloadproc load) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+static GLADloadproc glad_user_load = NULL;
+unsigned int gladGLLookups = 0;
+
+/* Lazy stubs may run on any thread with a current context, such as the
+ * toolkit's loader and present threads, so the lookup count and the
+ * resolved pointers are updated atomically. A thread that races another
+ * through the same stub looks the symbol up twice and stores the same
+ * pointer. (Added by hand.) */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define GLAD_COUNT_LOOKUP() \
+    InterlockedIncrement((volatile LONG*)&gladGLLookups)
+#define GLAD_PUBLISH(slot, value) \
+    InterlockedExchangePointer((PVOID volatile*)&(slot), (PVOID)(value))
+#else
+#define GLAD_COUNT_LOOKUP() \
+    __atomic_fetch_add(&gladGLLookups, 1u, __ATOMIC_RELAXED)
+#define GLAD_PUBLISH(slot, value) \
+    __atomic_store_n(&(slot), (value), __ATOMIC_RELEASE)
+#endif
+
+static void* glad_counted_load(const char *name) {
+    GLAD_COUNT_LOOKUP();
+    return glad_user_load(name);
+}
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+    GLAD_PUBLISH(glad_glCullFace, (PFNGLCULLFACEPROC)glad_counted_load("glCullFace"));
+    glad_glCullFace(mode);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+    GLAD_PUBLISH(glad_glFrontFace, (PFNGLFRONTFACEPROC)glad_counted_load("glFrontFace"));
+    glad_glFrontFace(mode);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+    GLAD_PUBLISH(glad_glHint, (PFNGLHINTPROC)glad_counted_load("glHint"));
+    glad_glHint(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+    GLAD_PUBLISH(glad_glLineWidth, (PFNGLLINEWIDTHPROC)glad_counted_load("glLineWidth"));
+    glad_glLineWidth(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+    GLAD_PUBLISH(glad_glPointSize, (PFNGLPOINTSIZEPROC)glad_counted_load("glPointSize"));
+    glad_glPointSize(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+    GLAD_PUBLISH(glad_glPolygonMode, (PFNGLPOLYGONMODEPROC)glad_counted_load("glPolygonMode"));
+    glad_glPolygonMode(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    GLAD_PUBLISH(glad_glScissor, (PFNGLSCISSORPROC)glad_counted_load("glScissor"));
+    glad_glScissor(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    GLAD_PUBLISH(glad_glTexParameterf, (PFNGLTEXPARAMETERFPROC)glad_counted_load("glTexParameterf"));
+    glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    GLAD_PUBLISH(glad_glTexParameterfv, (PFNGLTEXPARAMETERFVPROC)glad_counted_load("glTexParameterfv"));
+    glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    GLAD_PUBLISH(glad_glTexParameteri, (PFNGLTEXPARAMETERIPROC)glad_counted_load("glTexParameteri"));
+    glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    GLAD_PUBLISH(glad_glTexParameteriv, (PFNGLTEXPARAMETERIVPROC)glad_counted_load("glTexParameteriv"));
+    glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    GLAD_PUBLISH(glad_glTexImage1D, (PFNGLTEXIMAGE1DPROC)glad_counted_load("glTexImage1D"));
+    glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    GLAD_PUBLISH(glad_glTexImage2D, (PFNGLTEXIMAGE2DPROC)glad_counted_load("glTexImage2D"));
+    glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+    GLAD_PUBLISH(glad_glDrawBuffer, (PFNGLDRAWBUFFERPROC)glad_counted_load("glDrawBuffer"));
+    glad_glDrawBuffer(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+    GLAD_PUBLISH(glad_glClear, (PFNGLCLEARPROC)glad_counted_load("glClear"));
+    glad_glClear(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GLAD_PUBLISH(glad_glClearColor, (PFNGLCLEARCOLORPROC)glad_counted_load("glClearColor"));
+    glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+    GLAD_PUBLISH(glad_glClearStencil, (PFNGLCLEARSTENCILPROC)glad_counted_load("glClearStencil"));
+    glad_glClearStencil(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+    GLAD_PUBLISH(glad_glClearDepth, (PFNGLCLEARDEPTHPROC)glad_counted_load("glClearDepth"));
+    glad_glClearDepth(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+    GLAD_PUBLISH(glad_glStencilMask, (PFNGLSTENCILMASKPROC)glad_counted_load("glStencilMask"));
+    glad_glStencilMask(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    GLAD_PUBLISH(glad_glColorMask, (PFNGLCOLORMASKPROC)glad_counted_load("glColorMask"));
+    glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+    GLAD_PUBLISH(glad_glDepthMask, (PFNGLDEPTHMASKPROC)glad_counted_load("glDepthMask"));
+    glad_glDepthMask(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+    GLAD_PUBLISH(glad_glDisable, (PFNGLDISABLEPROC)glad_counted_load("glDisable"));
+    glad_glDisable(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+    GLAD_PUBLISH(glad_glEnable, (PFNGLENABLEPROC)glad_counted_load("glEnable"));
+    glad_glEnable(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+    GLAD_PUBLISH(glad_glFinish, (PFNGLFINISHPROC)glad_counted_load("glFinish"));
+    glad_glFinish();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+    GLAD_PUBLISH(glad_glFlush, (PFNGLFLUSHPROC)glad_counted_load("glFlush"));
+    glad_glFlush();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    GLAD_PUBLISH(glad_glBlendFunc, (PFNGLBLENDFUNCPROC)glad_counted_load("glBlendFunc"));
+    glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+    GLAD_PUBLISH(glad_glLogicOp, (PFNGLLOGICOPPROC)glad_counted_load("glLogicOp"));
+    glad_glLogicOp(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    GLAD_PUBLISH(glad_glStencilFunc, (PFNGLSTENCILFUNCPROC)glad_counted_load("glStencilFunc"));
+    glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    GLAD_PUBLISH(glad_glStencilOp, (PFNGLSTENCILOPPROC)glad_counted_load("glStencilOp"));
+    glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+    GLAD_PUBLISH(glad_glDepthFunc, (PFNGLDEPTHFUNCPROC)glad_counted_load("glDepthFunc"));
+    glad_glDepthFunc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+    GLAD_PUBLISH(glad_glPixelStoref, (PFNGLPIXELSTOREFPROC)glad_counted_load("glPixelStoref"));
+    glad_glPixelStoref(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+    GLAD_PUBLISH(glad_glPixelStorei, (PFNGLPIXELSTOREIPROC)glad_counted_load("glPixelStorei"));
+    glad_glPixelStorei(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+    GLAD_PUBLISH(glad_glReadBuffer, (PFNGLREADBUFFERPROC)glad_counted_load("glReadBuffer"));
+    glad_glReadBuffer(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    GLAD_PUBLISH(glad_glReadPixels, (PFNGLREADPIXELSPROC)glad_counted_load("glReadPixels"));
+    glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+    GLAD_PUBLISH(glad_glGetBooleanv, (PFNGLGETBOOLEANVPROC)glad_counted_load("glGetBooleanv"));
+    glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+    GLAD_PUBLISH(glad_glGetDoublev, (PFNGLGETDOUBLEVPROC)glad_counted_load("glGetDoublev"));
+    glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+    GLAD_PUBLISH(glad_glGetError, (PFNGLGETERRORPROC)glad_counted_load("glGetError"));
+    return glad_glGetError();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+    GLAD_PUBLISH(glad_glGetFloatv, (PFNGLGETFLOATVPROC)glad_counted_load("glGetFloatv"));
+    glad_glGetFloatv(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+    GLAD_PUBLISH(glad_glGetIntegerv, (PFNGLGETINTEGERVPROC)glad_counted_load("glGetIntegerv"));
+    glad_glGetIntegerv(pname, data);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetString(GLenum name) {
+    GLAD_PUBLISH(glad_glGetString, (PFNGLGETSTRINGPROC)glad_counted_load("glGetString"));
+    return glad_glGetString(name);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    GLAD_PUBLISH(glad_glGetTexImage, (PFNGLGETTEXIMAGEPROC)glad_counted_load("glGetTexImage"));
+    glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    GLAD_PUBLISH(glad_glGetTexParameterfv, (PFNGLGETTEXPARAMETERFVPROC)glad_counted_load("glGetTexParameterfv"));
+    glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetTexParameteriv, (PFNGLGETTEXPARAMETERIVPROC)glad_counted_load("glGetTexParameteriv"));
+    glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    GLAD_PUBLISH(glad_glGetTexLevelParameterfv, (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_counted_load("glGetTexLevelParameterfv"));
+    glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetTexLevelParameteriv, (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_counted_load("glGetTexLevelParameteriv"));
+    glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+    GLAD_PUBLISH(glad_glIsEnabled, (PFNGLISENABLEDPROC)glad_counted_load("glIsEnabled"));
+    return glad_glIsEnabled(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble n, GLdouble f) {
+    GLAD_PUBLISH(glad_glDepthRange, (PFNGLDEPTHRANGEPROC)glad_counted_load("glDepthRange"));
+    glad_glDepthRange(n, f);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    GLAD_PUBLISH(glad_glViewport, (PFNGLVIEWPORTPROC)glad_counted_load("glViewport"));
+    glad_glViewport(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    GLAD_PUBLISH(glad_glDrawArrays, (PFNGLDRAWARRAYSPROC)glad_counted_load("glDrawArrays"));
+    glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    GLAD_PUBLISH(glad_glDrawElements, (PFNGLDRAWELEMENTSPROC)glad_counted_load("glDrawElements"));
+    glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+    GLAD_PUBLISH(glad_glPolygonOffset, (PFNGLPOLYGONOFFSETPROC)glad_counted_load("glPolygonOffset"));
+    glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    GLAD_PUBLISH(glad_glCopyTexImage1D, (PFNGLCOPYTEXIMAGE1DPROC)glad_counted_load("glCopyTexImage1D"));
+    glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    GLAD_PUBLISH(glad_glCopyTexImage2D, (PFNGLCOPYTEXIMAGE2DPROC)glad_counted_load("glCopyTexImage2D"));
+    glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    GLAD_PUBLISH(glad_glCopyTexSubImage1D, (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_counted_load("glCopyTexSubImage1D"));
+    glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GLAD_PUBLISH(glad_glCopyTexSubImage2D, (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_counted_load("glCopyTexSubImage2D"));
+    glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    GLAD_PUBLISH(glad_glTexSubImage1D, (PFNGLTEXSUBIMAGE1DPROC)glad_counted_load("glTexSubImage1D"));
+    glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    GLAD_PUBLISH(glad_glTexSubImage2D, (PFNGLTEXSUBIMAGE2DPROC)glad_counted_load("glTexSubImage2D"));
+    glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+    GLAD_PUBLISH(glad_glBindTexture, (PFNGLBINDTEXTUREPROC)glad_counted_load("glBindTexture"));
+    glad_glBindTexture(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    GLAD_PUBLISH(glad_glDeleteTextures, (PFNGLDELETETEXTURESPROC)glad_counted_load("glDeleteTextures"));
+    glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+    GLAD_PUBLISH(glad_glGenTextures, (PFNGLGENTEXTURESPROC)glad_counted_load("glGenTextures"));
+    glad_glGenTextures(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+    GLAD_PUBLISH(glad_glIsTexture, (PFNGLISTEXTUREPROC)glad_counted_load("glIsTexture"));
+    return glad_glIsTexture(texture);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    GLAD_PUBLISH(glad_glDrawRangeElements, (PFNGLDRAWRANGEELEMENTSPROC)glad_counted_load("glDrawRangeElements"));
+    glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    GLAD_PUBLISH(glad_glTexImage3D, (PFNGLTEXIMAGE3DPROC)glad_counted_load("glTexImage3D"));
+    glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    GLAD_PUBLISH(glad_glTexSubImage3D, (PFNGLTEXSUBIMAGE3DPROC)glad_counted_load("glTexSubImage3D"));
+    glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    GLAD_PUBLISH(glad_glCopyTexSubImage3D, (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_counted_load("glCopyTexSubImage3D"));
+    glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+    GLAD_PUBLISH(glad_glActiveTexture, (PFNGLACTIVETEXTUREPROC)glad_counted_load("glActiveTexture"));
+    glad_glActiveTexture(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+    GLAD_PUBLISH(glad_glSampleCoverage, (PFNGLSAMPLECOVERAGEPROC)glad_counted_load("glSampleCoverage"));
+    glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    GLAD_PUBLISH(glad_glCompressedTexImage3D, (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_counted_load("glCompressedTexImage3D"));
+    glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    GLAD_PUBLISH(glad_glCompressedTexImage2D, (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_counted_load("glCompressedTexImage2D"));
+    glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    GLAD_PUBLISH(glad_glCompressedTexImage1D, (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_counted_load("glCompressedTexImage1D"));
+    glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    GLAD_PUBLISH(glad_glCompressedTexSubImage3D, (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_counted_load("glCompressedTexSubImage3D"));
+    glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    GLAD_PUBLISH(glad_glCompressedTexSubImage2D, (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_counted_load("glCompressedTexSubImage2D"));
+    glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    GLAD_PUBLISH(glad_glCompressedTexSubImage1D, (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_counted_load("glCompressedTexSubImage1D"));
+    glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    GLAD_PUBLISH(glad_glGetCompressedTexImage, (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_counted_load("glGetCompressedTexImage"));
+    glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    GLAD_PUBLISH(glad_glBlendFuncSeparate, (PFNGLBLENDFUNCSEPARATEPROC)glad_counted_load("glBlendFuncSeparate"));
+    glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    GLAD_PUBLISH(glad_glMultiDrawArrays, (PFNGLMULTIDRAWARRAYSPROC)glad_counted_load("glMultiDrawArrays"));
+    glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    GLAD_PUBLISH(glad_glMultiDrawElements, (PFNGLMULTIDRAWELEMENTSPROC)glad_counted_load("glMultiDrawElements"));
+    glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+    GLAD_PUBLISH(glad_glPointParameterf, (PFNGLPOINTPARAMETERFPROC)glad_counted_load("glPointParameterf"));
+    glad_glPointParameterf(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    GLAD_PUBLISH(glad_glPointParameterfv, (PFNGLPOINTPARAMETERFVPROC)glad_counted_load("glPointParameterfv"));
+    glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+    GLAD_PUBLISH(glad_glPointParameteri, (PFNGLPOINTPARAMETERIPROC)glad_counted_load("glPointParameteri"));
+    glad_glPointParameteri(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+    GLAD_PUBLISH(glad_glPointParameteriv, (PFNGLPOINTPARAMETERIVPROC)glad_counted_load("glPointParameteriv"));
+    glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    GLAD_PUBLISH(glad_glBlendColor, (PFNGLBLENDCOLORPROC)glad_counted_load("glBlendColor"));
+    glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+    GLAD_PUBLISH(glad_glBlendEquation, (PFNGLBLENDEQUATIONPROC)glad_counted_load("glBlendEquation"));
+    glad_glBlendEquation(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+    GLAD_PUBLISH(glad_glGenQueries, (PFNGLGENQUERIESPROC)glad_counted_load("glGenQueries"));
+    glad_glGenQueries(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    GLAD_PUBLISH(glad_glDeleteQueries, (PFNGLDELETEQUERIESPROC)glad_counted_load("glDeleteQueries"));
+    glad_glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+    GLAD_PUBLISH(glad_glIsQuery, (PFNGLISQUERYPROC)glad_counted_load("glIsQuery"));
+    return glad_glIsQuery(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+    GLAD_PUBLISH(glad_glBeginQuery, (PFNGLBEGINQUERYPROC)glad_counted_load("glBeginQuery"));
+    glad_glBeginQuery(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+    GLAD_PUBLISH(glad_glEndQuery, (PFNGLENDQUERYPROC)glad_counted_load("glEndQuery"));
+    glad_glEndQuery(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetQueryiv, (PFNGLGETQUERYIVPROC)glad_counted_load("glGetQueryiv"));
+    glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetQueryObjectiv, (PFNGLGETQUERYOBJECTIVPROC)glad_counted_load("glGetQueryObjectiv"));
+    glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    GLAD_PUBLISH(glad_glGetQueryObjectuiv, (PFNGLGETQUERYOBJECTUIVPROC)glad_counted_load("glGetQueryObjectuiv"));
+    glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+    GLAD_PUBLISH(glad_glBindBuffer, (PFNGLBINDBUFFERPROC)glad_counted_load("glBindBuffer"));
+    glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    GLAD_PUBLISH(glad_glDeleteBuffers, (PFNGLDELETEBUFFERSPROC)glad_counted_load("glDeleteBuffers"));
+    glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+    GLAD_PUBLISH(glad_glGenBuffers, (PFNGLGENBUFFERSPROC)glad_counted_load("glGenBuffers"));
+    glad_glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+    GLAD_PUBLISH(glad_glIsBuffer, (PFNGLISBUFFERPROC)glad_counted_load("glIsBuffer"));
+    return glad_glIsBuffer(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    GLAD_PUBLISH(glad_glBufferData, (PFNGLBUFFERDATAPROC)glad_counted_load("glBufferData"));
+    glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    GLAD_PUBLISH(glad_glBufferSubData, (PFNGLBUFFERSUBDATAPROC)glad_counted_load("glBufferSubData"));
+    glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    GLAD_PUBLISH(glad_glGetBufferSubData, (PFNGLGETBUFFERSUBDATAPROC)glad_counted_load("glGetBufferSubData"));
+    glad_glGetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+    GLAD_PUBLISH(glad_glMapBuffer, (PFNGLMAPBUFFERPROC)glad_counted_load("glMapBuffer"));
+    return glad_glMapBuffer(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+    GLAD_PUBLISH(glad_glUnmapBuffer, (PFNGLUNMAPBUFFERPROC)glad_counted_load("glUnmapBuffer"));
+    return glad_glUnmapBuffer(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetBufferParameteriv, (PFNGLGETBUFFERPARAMETERIVPROC)glad_counted_load("glGetBufferParameteriv"));
+    glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    GLAD_PUBLISH(glad_glGetBufferPointerv, (PFNGLGETBUFFERPOINTERVPROC)glad_counted_load("glGetBufferPointerv"));
+    glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    GLAD_PUBLISH(glad_glBlendEquationSeparate, (PFNGLBLENDEQUATIONSEPARATEPROC)glad_counted_load("glBlendEquationSeparate"));
+    glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    GLAD_PUBLISH(glad_glDrawBuffers, (PFNGLDRAWBUFFERSPROC)glad_counted_load("glDrawBuffers"));
+    glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    GLAD_PUBLISH(glad_glStencilOpSeparate, (PFNGLSTENCILOPSEPARATEPROC)glad_counted_load("glStencilOpSeparate"));
+    glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    GLAD_PUBLISH(glad_glStencilFuncSeparate, (PFNGLSTENCILFUNCSEPARATEPROC)glad_counted_load("glStencilFuncSeparate"));
+    glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    GLAD_PUBLISH(glad_glStencilMaskSeparate, (PFNGLSTENCILMASKSEPARATEPROC)glad_counted_load("glStencilMaskSeparate"));
+    glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+    GLAD_PUBLISH(glad_glAttachShader, (PFNGLATTACHSHADERPROC)glad_counted_load("glAttachShader"));
+    glad_glAttachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    GLAD_PUBLISH(glad_glBindAttribLocation, (PFNGLBINDATTRIBLOCATIONPROC)glad_counted_load("glBindAttribLocation"));
+    glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+    GLAD_PUBLISH(glad_glCompileShader, (PFNGLCOMPILESHADERPROC)glad_counted_load("glCompileShader"));
+    glad_glCompileShader(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+    GLAD_PUBLISH(glad_glCreateProgram, (PFNGLCREATEPROGRAMPROC)glad_counted_load("glCreateProgram"));
+    return glad_glCreateProgram();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+    GLAD_PUBLISH(glad_glCreateShader, (PFNGLCREATESHADERPROC)glad_counted_load("glCreateShader"));
+    return glad_glCreateShader(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+    GLAD_PUBLISH(glad_glDeleteProgram, (PFNGLDELETEPROGRAMPROC)glad_counted_load("glDeleteProgram"));
+    glad_glDeleteProgram(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+    GLAD_PUBLISH(glad_glDeleteShader, (PFNGLDELETESHADERPROC)glad_counted_load("glDeleteShader"));
+    glad_glDeleteShader(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+    GLAD_PUBLISH(glad_glDetachShader, (PFNGLDETACHSHADERPROC)glad_counted_load("glDetachShader"));
+    glad_glDetachShader(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+    GLAD_PUBLISH(glad_glDisableVertexAttribArray, (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_counted_load("glDisableVertexAttribArray"));
+    glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+    GLAD_PUBLISH(glad_glEnableVertexAttribArray, (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_counted_load("glEnableVertexAttribArray"));
+    glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    GLAD_PUBLISH(glad_glGetActiveAttrib, (PFNGLGETACTIVEATTRIBPROC)glad_counted_load("glGetActiveAttrib"));
+    glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    GLAD_PUBLISH(glad_glGetActiveUniform, (PFNGLGETACTIVEUNIFORMPROC)glad_counted_load("glGetActiveUniform"));
+    glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    GLAD_PUBLISH(glad_glGetAttachedShaders, (PFNGLGETATTACHEDSHADERSPROC)glad_counted_load("glGetAttachedShaders"));
+    glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+    GLAD_PUBLISH(glad_glGetAttribLocation, (PFNGLGETATTRIBLOCATIONPROC)glad_counted_load("glGetAttribLocation"));
+    return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetProgramiv, (PFNGLGETPROGRAMIVPROC)glad_counted_load("glGetProgramiv"));
+    glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    GLAD_PUBLISH(glad_glGetProgramInfoLog, (PFNGLGETPROGRAMINFOLOGPROC)glad_counted_load("glGetProgramInfoLog"));
+    glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetShaderiv, (PFNGLGETSHADERIVPROC)glad_counted_load("glGetShaderiv"));
+    glad_glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    GLAD_PUBLISH(glad_glGetShaderInfoLog, (PFNGLGETSHADERINFOLOGPROC)glad_counted_load("glGetShaderInfoLog"));
+    glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    GLAD_PUBLISH(glad_glGetShaderSource, (PFNGLGETSHADERSOURCEPROC)glad_counted_load("glGetShaderSource"));
+    glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+    GLAD_PUBLISH(glad_glGetUniformLocation, (PFNGLGETUNIFORMLOCATIONPROC)glad_counted_load("glGetUniformLocation"));
+    return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    GLAD_PUBLISH(glad_glGetUniformfv, (PFNGLGETUNIFORMFVPROC)glad_counted_load("glGetUniformfv"));
+    glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    GLAD_PUBLISH(glad_glGetUniformiv, (PFNGLGETUNIFORMIVPROC)glad_counted_load("glGetUniformiv"));
+    glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    GLAD_PUBLISH(glad_glGetVertexAttribdv, (PFNGLGETVERTEXATTRIBDVPROC)glad_counted_load("glGetVertexAttribdv"));
+    glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    GLAD_PUBLISH(glad_glGetVertexAttribfv, (PFNGLGETVERTEXATTRIBFVPROC)glad_counted_load("glGetVertexAttribfv"));
+    glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetVertexAttribiv, (PFNGLGETVERTEXATTRIBIVPROC)glad_counted_load("glGetVertexAttribiv"));
+    glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    GLAD_PUBLISH(glad_glGetVertexAttribPointerv, (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_counted_load("glGetVertexAttribPointerv"));
+    glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+    GLAD_PUBLISH(glad_glIsProgram, (PFNGLISPROGRAMPROC)glad_counted_load("glIsProgram"));
+    return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+    GLAD_PUBLISH(glad_glIsShader, (PFNGLISSHADERPROC)glad_counted_load("glIsShader"));
+    return glad_glIsShader(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+    GLAD_PUBLISH(glad_glLinkProgram, (PFNGLLINKPROGRAMPROC)glad_counted_load("glLinkProgram"));
+    glad_glLinkProgram(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    GLAD_PUBLISH(glad_glShaderSource, (PFNGLSHADERSOURCEPROC)glad_counted_load("glShaderSource"));
+    glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+    GLAD_PUBLISH(glad_glUseProgram, (PFNGLUSEPROGRAMPROC)glad_counted_load("glUseProgram"));
+    glad_glUseProgram(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+    GLAD_PUBLISH(glad_glUniform1f, (PFNGLUNIFORM1FPROC)glad_counted_load("glUniform1f"));
+    glad_glUniform1f(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    GLAD_PUBLISH(glad_glUniform2f, (PFNGLUNIFORM2FPROC)glad_counted_load("glUniform2f"));
+    glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    GLAD_PUBLISH(glad_glUniform3f, (PFNGLUNIFORM3FPROC)glad_counted_load("glUniform3f"));
+    glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    GLAD_PUBLISH(glad_glUniform4f, (PFNGLUNIFORM4FPROC)glad_counted_load("glUniform4f"));
+    glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+    GLAD_PUBLISH(glad_glUniform1i, (PFNGLUNIFORM1IPROC)glad_counted_load("glUniform1i"));
+    glad_glUniform1i(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+    GLAD_PUBLISH(glad_glUniform2i, (PFNGLUNIFORM2IPROC)glad_counted_load("glUniform2i"));
+    glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    GLAD_PUBLISH(glad_glUniform3i, (PFNGLUNIFORM3IPROC)glad_counted_load("glUniform3i"));
+    glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    GLAD_PUBLISH(glad_glUniform4i, (PFNGLUNIFORM4IPROC)glad_counted_load("glUniform4i"));
+    glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniform1fv, (PFNGLUNIFORM1FVPROC)glad_counted_load("glUniform1fv"));
+    glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniform2fv, (PFNGLUNIFORM2FVPROC)glad_counted_load("glUniform2fv"));
+    glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniform3fv, (PFNGLUNIFORM3FVPROC)glad_counted_load("glUniform3fv"));
+    glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniform4fv, (PFNGLUNIFORM4FVPROC)glad_counted_load("glUniform4fv"));
+    glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    GLAD_PUBLISH(glad_glUniform1iv, (PFNGLUNIFORM1IVPROC)glad_counted_load("glUniform1iv"));
+    glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    GLAD_PUBLISH(glad_glUniform2iv, (PFNGLUNIFORM2IVPROC)glad_counted_load("glUniform2iv"));
+    glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    GLAD_PUBLISH(glad_glUniform3iv, (PFNGLUNIFORM3IVPROC)glad_counted_load("glUniform3iv"));
+    glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    GLAD_PUBLISH(glad_glUniform4iv, (PFNGLUNIFORM4IVPROC)glad_counted_load("glUniform4iv"));
+    glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix2fv, (PFNGLUNIFORMMATRIX2FVPROC)glad_counted_load("glUniformMatrix2fv"));
+    glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix3fv, (PFNGLUNIFORMMATRIX3FVPROC)glad_counted_load("glUniformMatrix3fv"));
+    glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix4fv, (PFNGLUNIFORMMATRIX4FVPROC)glad_counted_load("glUniformMatrix4fv"));
+    glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+    GLAD_PUBLISH(glad_glValidateProgram, (PFNGLVALIDATEPROGRAMPROC)glad_counted_load("glValidateProgram"));
+    glad_glValidateProgram(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+    GLAD_PUBLISH(glad_glVertexAttrib1d, (PFNGLVERTEXATTRIB1DPROC)glad_counted_load("glVertexAttrib1d"));
+    glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib1dv, (PFNGLVERTEXATTRIB1DVPROC)glad_counted_load("glVertexAttrib1dv"));
+    glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+    GLAD_PUBLISH(glad_glVertexAttrib1f, (PFNGLVERTEXATTRIB1FPROC)glad_counted_load("glVertexAttrib1f"));
+    glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib1fv, (PFNGLVERTEXATTRIB1FVPROC)glad_counted_load("glVertexAttrib1fv"));
+    glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+    GLAD_PUBLISH(glad_glVertexAttrib1s, (PFNGLVERTEXATTRIB1SPROC)glad_counted_load("glVertexAttrib1s"));
+    glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib1sv, (PFNGLVERTEXATTRIB1SVPROC)glad_counted_load("glVertexAttrib1sv"));
+    glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    GLAD_PUBLISH(glad_glVertexAttrib2d, (PFNGLVERTEXATTRIB2DPROC)glad_counted_load("glVertexAttrib2d"));
+    glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib2dv, (PFNGLVERTEXATTRIB2DVPROC)glad_counted_load("glVertexAttrib2dv"));
+    glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    GLAD_PUBLISH(glad_glVertexAttrib2f, (PFNGLVERTEXATTRIB2FPROC)glad_counted_load("glVertexAttrib2f"));
+    glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib2fv, (PFNGLVERTEXATTRIB2FVPROC)glad_counted_load("glVertexAttrib2fv"));
+    glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    GLAD_PUBLISH(glad_glVertexAttrib2s, (PFNGLVERTEXATTRIB2SPROC)glad_counted_load("glVertexAttrib2s"));
+    glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib2sv, (PFNGLVERTEXATTRIB2SVPROC)glad_counted_load("glVertexAttrib2sv"));
+    glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    GLAD_PUBLISH(glad_glVertexAttrib3d, (PFNGLVERTEXATTRIB3DPROC)glad_counted_load("glVertexAttrib3d"));
+    glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib3dv, (PFNGLVERTEXATTRIB3DVPROC)glad_counted_load("glVertexAttrib3dv"));
+    glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    GLAD_PUBLISH(glad_glVertexAttrib3f, (PFNGLVERTEXATTRIB3FPROC)glad_counted_load("glVertexAttrib3f"));
+    glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib3fv, (PFNGLVERTEXATTRIB3FVPROC)glad_counted_load("glVertexAttrib3fv"));
+    glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    GLAD_PUBLISH(glad_glVertexAttrib3s, (PFNGLVERTEXATTRIB3SPROC)glad_counted_load("glVertexAttrib3s"));
+    glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib3sv, (PFNGLVERTEXATTRIB3SVPROC)glad_counted_load("glVertexAttrib3sv"));
+    glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Nbv, (PFNGLVERTEXATTRIB4NBVPROC)glad_counted_load("glVertexAttrib4Nbv"));
+    glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Niv, (PFNGLVERTEXATTRIB4NIVPROC)glad_counted_load("glVertexAttrib4Niv"));
+    glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Nsv, (PFNGLVERTEXATTRIB4NSVPROC)glad_counted_load("glVertexAttrib4Nsv"));
+    glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Nub, (PFNGLVERTEXATTRIB4NUBPROC)glad_counted_load("glVertexAttrib4Nub"));
+    glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Nubv, (PFNGLVERTEXATTRIB4NUBVPROC)glad_counted_load("glVertexAttrib4Nubv"));
+    glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Nuiv, (PFNGLVERTEXATTRIB4NUIVPROC)glad_counted_load("glVertexAttrib4Nuiv"));
+    glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4Nusv, (PFNGLVERTEXATTRIB4NUSVPROC)glad_counted_load("glVertexAttrib4Nusv"));
+    glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4bv, (PFNGLVERTEXATTRIB4BVPROC)glad_counted_load("glVertexAttrib4bv"));
+    glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    GLAD_PUBLISH(glad_glVertexAttrib4d, (PFNGLVERTEXATTRIB4DPROC)glad_counted_load("glVertexAttrib4d"));
+    glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4dv, (PFNGLVERTEXATTRIB4DVPROC)glad_counted_load("glVertexAttrib4dv"));
+    glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    GLAD_PUBLISH(glad_glVertexAttrib4f, (PFNGLVERTEXATTRIB4FPROC)glad_counted_load("glVertexAttrib4f"));
+    glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4fv, (PFNGLVERTEXATTRIB4FVPROC)glad_counted_load("glVertexAttrib4fv"));
+    glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4iv, (PFNGLVERTEXATTRIB4IVPROC)glad_counted_load("glVertexAttrib4iv"));
+    glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    GLAD_PUBLISH(glad_glVertexAttrib4s, (PFNGLVERTEXATTRIB4SPROC)glad_counted_load("glVertexAttrib4s"));
+    glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4sv, (PFNGLVERTEXATTRIB4SVPROC)glad_counted_load("glVertexAttrib4sv"));
+    glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4ubv, (PFNGLVERTEXATTRIB4UBVPROC)glad_counted_load("glVertexAttrib4ubv"));
+    glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4uiv, (PFNGLVERTEXATTRIB4UIVPROC)glad_counted_load("glVertexAttrib4uiv"));
+    glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    GLAD_PUBLISH(glad_glVertexAttrib4usv, (PFNGLVERTEXATTRIB4USVPROC)glad_counted_load("glVertexAttrib4usv"));
+    glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    GLAD_PUBLISH(glad_glVertexAttribPointer, (PFNGLVERTEXATTRIBPOINTERPROC)glad_counted_load("glVertexAttribPointer"));
+    glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix2x3fv, (PFNGLUNIFORMMATRIX2X3FVPROC)glad_counted_load("glUniformMatrix2x3fv"));
+    glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix3x2fv, (PFNGLUNIFORMMATRIX3X2FVPROC)glad_counted_load("glUniformMatrix3x2fv"));
+    glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix2x4fv, (PFNGLUNIFORMMATRIX2X4FVPROC)glad_counted_load("glUniformMatrix2x4fv"));
+    glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix4x2fv, (PFNGLUNIFORMMATRIX4X2FVPROC)glad_counted_load("glUniformMatrix4x2fv"));
+    glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix3x4fv, (PFNGLUNIFORMMATRIX3X4FVPROC)glad_counted_load("glUniformMatrix3x4fv"));
+    glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glUniformMatrix4x3fv, (PFNGLUNIFORMMATRIX4X3FVPROC)glad_counted_load("glUniformMatrix4x3fv"));
+    glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    GLAD_PUBLISH(glad_glColorMaski, (PFNGLCOLORMASKIPROC)glad_counted_load("glColorMaski"));
+    glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    GLAD_PUBLISH(glad_glGetBooleani_v, (PFNGLGETBOOLEANI_VPROC)glad_counted_load("glGetBooleani_v"));
+    glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    GLAD_PUBLISH(glad_glGetIntegeri_v, (PFNGLGETINTEGERI_VPROC)glad_counted_load("glGetIntegeri_v"));
+    glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+    GLAD_PUBLISH(glad_glEnablei, (PFNGLENABLEIPROC)glad_counted_load("glEnablei"));
+    glad_glEnablei(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+    GLAD_PUBLISH(glad_glDisablei, (PFNGLDISABLEIPROC)glad_counted_load("glDisablei"));
+    glad_glDisablei(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+    GLAD_PUBLISH(glad_glIsEnabledi, (PFNGLISENABLEDIPROC)glad_counted_load("glIsEnabledi"));
+    return glad_glIsEnabledi(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+    GLAD_PUBLISH(glad_glBeginTransformFeedback, (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_counted_load("glBeginTransformFeedback"));
+    glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+    GLAD_PUBLISH(glad_glEndTransformFeedback, (PFNGLENDTRANSFORMFEEDBACKPROC)glad_counted_load("glEndTransformFeedback"));
+    glad_glEndTransformFeedback();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    GLAD_PUBLISH(glad_glBindBufferRange, (PFNGLBINDBUFFERRANGEPROC)glad_counted_load("glBindBufferRange"));
+    glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    GLAD_PUBLISH(glad_glBindBufferBase, (PFNGLBINDBUFFERBASEPROC)glad_counted_load("glBindBufferBase"));
+    glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    GLAD_PUBLISH(glad_glTransformFeedbackVaryings, (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_counted_load("glTransformFeedbackVaryings"));
+    glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    GLAD_PUBLISH(glad_glGetTransformFeedbackVarying, (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_counted_load("glGetTransformFeedbackVarying"));
+    glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+    GLAD_PUBLISH(glad_glClampColor, (PFNGLCLAMPCOLORPROC)glad_counted_load("glClampColor"));
+    glad_glClampColor(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+    GLAD_PUBLISH(glad_glBeginConditionalRender, (PFNGLBEGINCONDITIONALRENDERPROC)glad_counted_load("glBeginConditionalRender"));
+    glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+    GLAD_PUBLISH(glad_glEndConditionalRender, (PFNGLENDCONDITIONALRENDERPROC)glad_counted_load("glEndConditionalRender"));
+    glad_glEndConditionalRender();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    GLAD_PUBLISH(glad_glVertexAttribIPointer, (PFNGLVERTEXATTRIBIPOINTERPROC)glad_counted_load("glVertexAttribIPointer"));
+    glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetVertexAttribIiv, (PFNGLGETVERTEXATTRIBIIVPROC)glad_counted_load("glGetVertexAttribIiv"));
+    glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    GLAD_PUBLISH(glad_glGetVertexAttribIuiv, (PFNGLGETVERTEXATTRIBIUIVPROC)glad_counted_load("glGetVertexAttribIuiv"));
+    glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+    GLAD_PUBLISH(glad_glVertexAttribI1i, (PFNGLVERTEXATTRIBI1IPROC)glad_counted_load("glVertexAttribI1i"));
+    glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    GLAD_PUBLISH(glad_glVertexAttribI2i, (PFNGLVERTEXATTRIBI2IPROC)glad_counted_load("glVertexAttribI2i"));
+    glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    GLAD_PUBLISH(glad_glVertexAttribI3i, (PFNGLVERTEXATTRIBI3IPROC)glad_counted_load("glVertexAttribI3i"));
+    glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    GLAD_PUBLISH(glad_glVertexAttribI4i, (PFNGLVERTEXATTRIBI4IPROC)glad_counted_load("glVertexAttribI4i"));
+    glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+    GLAD_PUBLISH(glad_glVertexAttribI1ui, (PFNGLVERTEXATTRIBI1UIPROC)glad_counted_load("glVertexAttribI1ui"));
+    glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    GLAD_PUBLISH(glad_glVertexAttribI2ui, (PFNGLVERTEXATTRIBI2UIPROC)glad_counted_load("glVertexAttribI2ui"));
+    glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    GLAD_PUBLISH(glad_glVertexAttribI3ui, (PFNGLVERTEXATTRIBI3UIPROC)glad_counted_load("glVertexAttribI3ui"));
+    glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    GLAD_PUBLISH(glad_glVertexAttribI4ui, (PFNGLVERTEXATTRIBI4UIPROC)glad_counted_load("glVertexAttribI4ui"));
+    glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI1iv, (PFNGLVERTEXATTRIBI1IVPROC)glad_counted_load("glVertexAttribI1iv"));
+    glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI2iv, (PFNGLVERTEXATTRIBI2IVPROC)glad_counted_load("glVertexAttribI2iv"));
+    glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI3iv, (PFNGLVERTEXATTRIBI3IVPROC)glad_counted_load("glVertexAttribI3iv"));
+    glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI4iv, (PFNGLVERTEXATTRIBI4IVPROC)glad_counted_load("glVertexAttribI4iv"));
+    glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI1uiv, (PFNGLVERTEXATTRIBI1UIVPROC)glad_counted_load("glVertexAttribI1uiv"));
+    glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI2uiv, (PFNGLVERTEXATTRIBI2UIVPROC)glad_counted_load("glVertexAttribI2uiv"));
+    glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI3uiv, (PFNGLVERTEXATTRIBI3UIVPROC)glad_counted_load("glVertexAttribI3uiv"));
+    glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI4uiv, (PFNGLVERTEXATTRIBI4UIVPROC)glad_counted_load("glVertexAttribI4uiv"));
+    glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI4bv, (PFNGLVERTEXATTRIBI4BVPROC)glad_counted_load("glVertexAttribI4bv"));
+    glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI4sv, (PFNGLVERTEXATTRIBI4SVPROC)glad_counted_load("glVertexAttribI4sv"));
+    glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI4ubv, (PFNGLVERTEXATTRIBI4UBVPROC)glad_counted_load("glVertexAttribI4ubv"));
+    glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    GLAD_PUBLISH(glad_glVertexAttribI4usv, (PFNGLVERTEXATTRIBI4USVPROC)glad_counted_load("glVertexAttribI4usv"));
+    glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    GLAD_PUBLISH(glad_glGetUniformuiv, (PFNGLGETUNIFORMUIVPROC)glad_counted_load("glGetUniformuiv"));
+    glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    GLAD_PUBLISH(glad_glBindFragDataLocation, (PFNGLBINDFRAGDATALOCATIONPROC)glad_counted_load("glBindFragDataLocation"));
+    glad_glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    GLAD_PUBLISH(glad_glGetFragDataLocation, (PFNGLGETFRAGDATALOCATIONPROC)glad_counted_load("glGetFragDataLocation"));
+    return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+    GLAD_PUBLISH(glad_glUniform1ui, (PFNGLUNIFORM1UIPROC)glad_counted_load("glUniform1ui"));
+    glad_glUniform1ui(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    GLAD_PUBLISH(glad_glUniform2ui, (PFNGLUNIFORM2UIPROC)glad_counted_load("glUniform2ui"));
+    glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    GLAD_PUBLISH(glad_glUniform3ui, (PFNGLUNIFORM3UIPROC)glad_counted_load("glUniform3ui"));
+    glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    GLAD_PUBLISH(glad_glUniform4ui, (PFNGLUNIFORM4UIPROC)glad_counted_load("glUniform4ui"));
+    glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    GLAD_PUBLISH(glad_glUniform1uiv, (PFNGLUNIFORM1UIVPROC)glad_counted_load("glUniform1uiv"));
+    glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    GLAD_PUBLISH(glad_glUniform2uiv, (PFNGLUNIFORM2UIVPROC)glad_counted_load("glUniform2uiv"));
+    glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    GLAD_PUBLISH(glad_glUniform3uiv, (PFNGLUNIFORM3UIVPROC)glad_counted_load("glUniform3uiv"));
+    glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    GLAD_PUBLISH(glad_glUniform4uiv, (PFNGLUNIFORM4UIVPROC)glad_counted_load("glUniform4uiv"));
+    glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    GLAD_PUBLISH(glad_glTexParameterIiv, (PFNGLTEXPARAMETERIIVPROC)glad_counted_load("glTexParameterIiv"));
+    glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    GLAD_PUBLISH(glad_glTexParameterIuiv, (PFNGLTEXPARAMETERIUIVPROC)glad_counted_load("glTexParameterIuiv"));
+    glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetTexParameterIiv, (PFNGLGETTEXPARAMETERIIVPROC)glad_counted_load("glGetTexParameterIiv"));
+    glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    GLAD_PUBLISH(glad_glGetTexParameterIuiv, (PFNGLGETTEXPARAMETERIUIVPROC)glad_counted_load("glGetTexParameterIuiv"));
+    glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    GLAD_PUBLISH(glad_glClearBufferiv, (PFNGLCLEARBUFFERIVPROC)glad_counted_load("glClearBufferiv"));
+    glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    GLAD_PUBLISH(glad_glClearBufferuiv, (PFNGLCLEARBUFFERUIVPROC)glad_counted_load("glClearBufferuiv"));
+    glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    GLAD_PUBLISH(glad_glClearBufferfv, (PFNGLCLEARBUFFERFVPROC)glad_counted_load("glClearBufferfv"));
+    glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    GLAD_PUBLISH(glad_glClearBufferfi, (PFNGLCLEARBUFFERFIPROC)glad_counted_load("glClearBufferfi"));
+    glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+    GLAD_PUBLISH(glad_glGetStringi, (PFNGLGETSTRINGIPROC)glad_counted_load("glGetStringi"));
+    return glad_glGetStringi(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+    GLAD_PUBLISH(glad_glIsRenderbuffer, (PFNGLISRENDERBUFFERPROC)glad_counted_load("glIsRenderbuffer"));
+    return glad_glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    GLAD_PUBLISH(glad_glBindRenderbuffer, (PFNGLBINDRENDERBUFFERPROC)glad_counted_load("glBindRenderbuffer"));
+    glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    GLAD_PUBLISH(glad_glDeleteRenderbuffers, (PFNGLDELETERENDERBUFFERSPROC)glad_counted_load("glDeleteRenderbuffers"));
+    glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    GLAD_PUBLISH(glad_glGenRenderbuffers, (PFNGLGENRENDERBUFFERSPROC)glad_counted_load("glGenRenderbuffers"));
+    glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    GLAD_PUBLISH(glad_glRenderbufferStorage, (PFNGLRENDERBUFFERSTORAGEPROC)glad_counted_load("glRenderbufferStorage"));
+    glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetRenderbufferParameteriv, (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_counted_load("glGetRenderbufferParameteriv"));
+    glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+    GLAD_PUBLISH(glad_glIsFramebuffer, (PFNGLISFRAMEBUFFERPROC)glad_counted_load("glIsFramebuffer"));
+    return glad_glIsFramebuffer(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    GLAD_PUBLISH(glad_glBindFramebuffer, (PFNGLBINDFRAMEBUFFERPROC)glad_counted_load("glBindFramebuffer"));
+    glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    GLAD_PUBLISH(glad_glDeleteFramebuffers, (PFNGLDELETEFRAMEBUFFERSPROC)glad_counted_load("glDeleteFramebuffers"));
+    glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    GLAD_PUBLISH(glad_glGenFramebuffers, (PFNGLGENFRAMEBUFFERSPROC)glad_counted_load("glGenFramebuffers"));
+    glad_glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+    GLAD_PUBLISH(glad_glCheckFramebufferStatus, (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_counted_load("glCheckFramebufferStatus"));
+    return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    GLAD_PUBLISH(glad_glFramebufferTexture1D, (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_counted_load("glFramebufferTexture1D"));
+    glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    GLAD_PUBLISH(glad_glFramebufferTexture2D, (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_counted_load("glFramebufferTexture2D"));
+    glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    GLAD_PUBLISH(glad_glFramebufferTexture3D, (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_counted_load("glFramebufferTexture3D"));
+    glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    GLAD_PUBLISH(glad_glFramebufferRenderbuffer, (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_counted_load("glFramebufferRenderbuffer"));
+    glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetFramebufferAttachmentParameteriv, (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_counted_load("glGetFramebufferAttachmentParameteriv"));
+    glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+    GLAD_PUBLISH(glad_glGenerateMipmap, (PFNGLGENERATEMIPMAPPROC)glad_counted_load("glGenerateMipmap"));
+    glad_glGenerateMipmap(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    GLAD_PUBLISH(glad_glBlitFramebuffer, (PFNGLBLITFRAMEBUFFERPROC)glad_counted_load("glBlitFramebuffer"));
+    glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    GLAD_PUBLISH(glad_glRenderbufferStorageMultisample, (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_counted_load("glRenderbufferStorageMultisample"));
+    glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    GLAD_PUBLISH(glad_glFramebufferTextureLayer, (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_counted_load("glFramebufferTextureLayer"));
+    glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    GLAD_PUBLISH(glad_glMapBufferRange, (PFNGLMAPBUFFERRANGEPROC)glad_counted_load("glMapBufferRange"));
+    return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    GLAD_PUBLISH(glad_glFlushMappedBufferRange, (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_counted_load("glFlushMappedBufferRange"));
+    glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+    GLAD_PUBLISH(glad_glBindVertexArray, (PFNGLBINDVERTEXARRAYPROC)glad_counted_load("glBindVertexArray"));
+    glad_glBindVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    GLAD_PUBLISH(glad_glDeleteVertexArrays, (PFNGLDELETEVERTEXARRAYSPROC)glad_counted_load("glDeleteVertexArrays"));
+    glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    GLAD_PUBLISH(glad_glGenVertexArrays, (PFNGLGENVERTEXARRAYSPROC)glad_counted_load("glGenVertexArrays"));
+    glad_glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+    GLAD_PUBLISH(glad_glIsVertexArray, (PFNGLISVERTEXARRAYPROC)glad_counted_load("glIsVertexArray"));
+    return glad_glIsVertexArray(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    GLAD_PUBLISH(glad_glDrawArraysInstanced, (PFNGLDRAWARRAYSINSTANCEDPROC)glad_counted_load("glDrawArraysInstanced"));
+    glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    GLAD_PUBLISH(glad_glDrawElementsInstanced, (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_counted_load("glDrawElementsInstanced"));
+    glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    GLAD_PUBLISH(glad_glTexBuffer, (PFNGLTEXBUFFERPROC)glad_counted_load("glTexBuffer"));
+    glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+    GLAD_PUBLISH(glad_glPrimitiveRestartIndex, (PFNGLPRIMITIVERESTARTINDEXPROC)glad_counted_load("glPrimitiveRestartIndex"));
+    glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    GLAD_PUBLISH(glad_glCopyBufferSubData, (PFNGLCOPYBUFFERSUBDATAPROC)glad_counted_load("glCopyBufferSubData"));
+    glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    GLAD_PUBLISH(glad_glGetUniformIndices, (PFNGLGETUNIFORMINDICESPROC)glad_counted_load("glGetUniformIndices"));
+    glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetActiveUniformsiv, (PFNGLGETACTIVEUNIFORMSIVPROC)glad_counted_load("glGetActiveUniformsiv"));
+    glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    GLAD_PUBLISH(glad_glGetActiveUniformName, (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_counted_load("glGetActiveUniformName"));
+    glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    GLAD_PUBLISH(glad_glGetUniformBlockIndex, (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_counted_load("glGetUniformBlockIndex"));
+    return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetActiveUniformBlockiv, (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_counted_load("glGetActiveUniformBlockiv"));
+    glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    GLAD_PUBLISH(glad_glGetActiveUniformBlockName, (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_counted_load("glGetActiveUniformBlockName"));
+    glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    GLAD_PUBLISH(glad_glUniformBlockBinding, (PFNGLUNIFORMBLOCKBINDINGPROC)glad_counted_load("glUniformBlockBinding"));
+    glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    GLAD_PUBLISH(glad_glDrawElementsBaseVertex, (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_counted_load("glDrawElementsBaseVertex"));
+    glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    GLAD_PUBLISH(glad_glDrawRangeElementsBaseVertex, (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_counted_load("glDrawRangeElementsBaseVertex"));
+    glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    GLAD_PUBLISH(glad_glDrawElementsInstancedBaseVertex, (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_counted_load("glDrawElementsInstancedBaseVertex"));
+    glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    GLAD_PUBLISH(glad_glMultiDrawElementsBaseVertex, (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_counted_load("glMultiDrawElementsBaseVertex"));
+    glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+    GLAD_PUBLISH(glad_glProvokingVertex, (PFNGLPROVOKINGVERTEXPROC)glad_counted_load("glProvokingVertex"));
+    glad_glProvokingVertex(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+    GLAD_PUBLISH(glad_glFenceSync, (PFNGLFENCESYNCPROC)glad_counted_load("glFenceSync"));
+    return glad_glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+    GLAD_PUBLISH(glad_glIsSync, (PFNGLISSYNCPROC)glad_counted_load("glIsSync"));
+    return glad_glIsSync(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+    GLAD_PUBLISH(glad_glDeleteSync, (PFNGLDELETESYNCPROC)glad_counted_load("glDeleteSync"));
+    glad_glDeleteSync(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GLAD_PUBLISH(glad_glClientWaitSync, (PFNGLCLIENTWAITSYNCPROC)glad_counted_load("glClientWaitSync"));
+    return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GLAD_PUBLISH(glad_glWaitSync, (PFNGLWAITSYNCPROC)glad_counted_load("glWaitSync"));
+    glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+    GLAD_PUBLISH(glad_glGetInteger64v, (PFNGLGETINTEGER64VPROC)glad_counted_load("glGetInteger64v"));
+    glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+    GLAD_PUBLISH(glad_glGetSynciv, (PFNGLGETSYNCIVPROC)glad_counted_load("glGetSynciv"));
+    glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    GLAD_PUBLISH(glad_glGetInteger64i_v, (PFNGLGETINTEGER64I_VPROC)glad_counted_load("glGetInteger64i_v"));
+    glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    GLAD_PUBLISH(glad_glGetBufferParameteri64v, (PFNGLGETBUFFERPARAMETERI64VPROC)glad_counted_load("glGetBufferParameteri64v"));
+    glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    GLAD_PUBLISH(glad_glFramebufferTexture, (PFNGLFRAMEBUFFERTEXTUREPROC)glad_counted_load("glFramebufferTexture"));
+    glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    GLAD_PUBLISH(glad_glTexImage2DMultisample, (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_counted_load("glTexImage2DMultisample"));
+    glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    GLAD_PUBLISH(glad_glTexImage3DMultisample, (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_counted_load("glTexImage3DMultisample"));
+    glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    GLAD_PUBLISH(glad_glGetMultisamplefv, (PFNGLGETMULTISAMPLEFVPROC)glad_counted_load("glGetMultisamplefv"));
+    glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    GLAD_PUBLISH(glad_glSampleMaski, (PFNGLSAMPLEMASKIPROC)glad_counted_load("glSampleMaski"));
+    glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    GLAD_PUBLISH(glad_glBindFragDataLocationIndexed, (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_counted_load("glBindFragDataLocationIndexed"));
+    glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    GLAD_PUBLISH(glad_glGetFragDataIndex, (PFNGLGETFRAGDATAINDEXPROC)glad_counted_load("glGetFragDataIndex"));
+    return glad_glGetFragDataIndex(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+    GLAD_PUBLISH(glad_glGenSamplers, (PFNGLGENSAMPLERSPROC)glad_counted_load("glGenSamplers"));
+    glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    GLAD_PUBLISH(glad_glDeleteSamplers, (PFNGLDELETESAMPLERSPROC)glad_counted_load("glDeleteSamplers"));
+    glad_glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+    GLAD_PUBLISH(glad_glIsSampler, (PFNGLISSAMPLERPROC)glad_counted_load("glIsSampler"));
+    return glad_glIsSampler(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+    GLAD_PUBLISH(glad_glBindSampler, (PFNGLBINDSAMPLERPROC)glad_counted_load("glBindSampler"));
+    glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    GLAD_PUBLISH(glad_glSamplerParameteri, (PFNGLSAMPLERPARAMETERIPROC)glad_counted_load("glSamplerParameteri"));
+    glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    GLAD_PUBLISH(glad_glSamplerParameteriv, (PFNGLSAMPLERPARAMETERIVPROC)glad_counted_load("glSamplerParameteriv"));
+    glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    GLAD_PUBLISH(glad_glSamplerParameterf, (PFNGLSAMPLERPARAMETERFPROC)glad_counted_load("glSamplerParameterf"));
+    glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    GLAD_PUBLISH(glad_glSamplerParameterfv, (PFNGLSAMPLERPARAMETERFVPROC)glad_counted_load("glSamplerParameterfv"));
+    glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    GLAD_PUBLISH(glad_glSamplerParameterIiv, (PFNGLSAMPLERPARAMETERIIVPROC)glad_counted_load("glSamplerParameterIiv"));
+    glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    GLAD_PUBLISH(glad_glSamplerParameterIuiv, (PFNGLSAMPLERPARAMETERIUIVPROC)glad_counted_load("glSamplerParameterIuiv"));
+    glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetSamplerParameteriv, (PFNGLGETSAMPLERPARAMETERIVPROC)glad_counted_load("glGetSamplerParameteriv"));
+    glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    GLAD_PUBLISH(glad_glGetSamplerParameterIiv, (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_counted_load("glGetSamplerParameterIiv"));
+    glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    GLAD_PUBLISH(glad_glGetSamplerParameterfv, (PFNGLGETSAMPLERPARAMETERFVPROC)glad_counted_load("glGetSamplerParameterfv"));
+    glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    GLAD_PUBLISH(glad_glGetSamplerParameterIuiv, (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_counted_load("glGetSamplerParameterIuiv"));
+    glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+    GLAD_PUBLISH(glad_glQueryCounter, (PFNGLQUERYCOUNTERPROC)glad_counted_load("glQueryCounter"));
+    glad_glQueryCounter(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    GLAD_PUBLISH(glad_glGetQueryObjecti64v, (PFNGLGETQUERYOBJECTI64VPROC)glad_counted_load("glGetQueryObjecti64v"));
+    glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    GLAD_PUBLISH(glad_glGetQueryObjectui64v, (PFNGLGETQUERYOBJECTUI64VPROC)glad_counted_load("glGetQueryObjectui64v"));
+    glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    GLAD_PUBLISH(glad_glVertexAttribDivisor, (PFNGLVERTEXATTRIBDIVISORPROC)glad_counted_load("glVertexAttribDivisor"));
+    glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexAttribP1ui, (PFNGLVERTEXATTRIBP1UIPROC)glad_counted_load("glVertexAttribP1ui"));
+    glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexAttribP1uiv, (PFNGLVERTEXATTRIBP1UIVPROC)glad_counted_load("glVertexAttribP1uiv"));
+    glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexAttribP2ui, (PFNGLVERTEXATTRIBP2UIPROC)glad_counted_load("glVertexAttribP2ui"));
+    glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexAttribP2uiv, (PFNGLVERTEXATTRIBP2UIVPROC)glad_counted_load("glVertexAttribP2uiv"));
+    glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexAttribP3ui, (PFNGLVERTEXATTRIBP3UIPROC)glad_counted_load("glVertexAttribP3ui"));
+    glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexAttribP3uiv, (PFNGLVERTEXATTRIBP3UIVPROC)glad_counted_load("glVertexAttribP3uiv"));
+    glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexAttribP4ui, (PFNGLVERTEXATTRIBP4UIPROC)glad_counted_load("glVertexAttribP4ui"));
+    glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexAttribP4uiv, (PFNGLVERTEXATTRIBP4UIVPROC)glad_counted_load("glVertexAttribP4uiv"));
+    glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexP2ui, (PFNGLVERTEXP2UIPROC)glad_counted_load("glVertexP2ui"));
+    glad_glVertexP2ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexP2uiv, (PFNGLVERTEXP2UIVPROC)glad_counted_load("glVertexP2uiv"));
+    glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexP3ui, (PFNGLVERTEXP3UIPROC)glad_counted_load("glVertexP3ui"));
+    glad_glVertexP3ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexP3uiv, (PFNGLVERTEXP3UIVPROC)glad_counted_load("glVertexP3uiv"));
+    glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+    GLAD_PUBLISH(glad_glVertexP4ui, (PFNGLVERTEXP4UIPROC)glad_counted_load("glVertexP4ui"));
+    glad_glVertexP4ui(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+    GLAD_PUBLISH(glad_glVertexP4uiv, (PFNGLVERTEXP4UIVPROC)glad_counted_load("glVertexP4uiv"));
+    glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glTexCoordP1ui, (PFNGLTEXCOORDP1UIPROC)glad_counted_load("glTexCoordP1ui"));
+    glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glTexCoordP1uiv, (PFNGLTEXCOORDP1UIVPROC)glad_counted_load("glTexCoordP1uiv"));
+    glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glTexCoordP2ui, (PFNGLTEXCOORDP2UIPROC)glad_counted_load("glTexCoordP2ui"));
+    glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glTexCoordP2uiv, (PFNGLTEXCOORDP2UIVPROC)glad_counted_load("glTexCoordP2uiv"));
+    glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glTexCoordP3ui, (PFNGLTEXCOORDP3UIPROC)glad_counted_load("glTexCoordP3ui"));
+    glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glTexCoordP3uiv, (PFNGLTEXCOORDP3UIVPROC)glad_counted_load("glTexCoordP3uiv"));
+    glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glTexCoordP4ui, (PFNGLTEXCOORDP4UIPROC)glad_counted_load("glTexCoordP4ui"));
+    glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glTexCoordP4uiv, (PFNGLTEXCOORDP4UIVPROC)glad_counted_load("glTexCoordP4uiv"));
+    glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP1ui, (PFNGLMULTITEXCOORDP1UIPROC)glad_counted_load("glMultiTexCoordP1ui"));
+    glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP1uiv, (PFNGLMULTITEXCOORDP1UIVPROC)glad_counted_load("glMultiTexCoordP1uiv"));
+    glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP2ui, (PFNGLMULTITEXCOORDP2UIPROC)glad_counted_load("glMultiTexCoordP2ui"));
+    glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP2uiv, (PFNGLMULTITEXCOORDP2UIVPROC)glad_counted_load("glMultiTexCoordP2uiv"));
+    glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP3ui, (PFNGLMULTITEXCOORDP3UIPROC)glad_counted_load("glMultiTexCoordP3ui"));
+    glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP3uiv, (PFNGLMULTITEXCOORDP3UIVPROC)glad_counted_load("glMultiTexCoordP3uiv"));
+    glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP4ui, (PFNGLMULTITEXCOORDP4UIPROC)glad_counted_load("glMultiTexCoordP4ui"));
+    glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glMultiTexCoordP4uiv, (PFNGLMULTITEXCOORDP4UIVPROC)glad_counted_load("glMultiTexCoordP4uiv"));
+    glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+    GLAD_PUBLISH(glad_glNormalP3ui, (PFNGLNORMALP3UIPROC)glad_counted_load("glNormalP3ui"));
+    glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    GLAD_PUBLISH(glad_glNormalP3uiv, (PFNGLNORMALP3UIVPROC)glad_counted_load("glNormalP3uiv"));
+    glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+    GLAD_PUBLISH(glad_glColorP3ui, (PFNGLCOLORP3UIPROC)glad_counted_load("glColorP3ui"));
+    glad_glColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+    GLAD_PUBLISH(glad_glColorP3uiv, (PFNGLCOLORP3UIVPROC)glad_counted_load("glColorP3uiv"));
+    glad_glColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+    GLAD_PUBLISH(glad_glColorP4ui, (PFNGLCOLORP4UIPROC)glad_counted_load("glColorP4ui"));
+    glad_glColorP4ui(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+    GLAD_PUBLISH(glad_glColorP4uiv, (PFNGLCOLORP4UIVPROC)glad_counted_load("glColorP4uiv"));
+    glad_glColorP4uiv(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    GLAD_PUBLISH(glad_glSecondaryColorP3ui, (PFNGLSECONDARYCOLORP3UIPROC)glad_counted_load("glSecondaryColorP3ui"));
+    glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    GLAD_PUBLISH(glad_glSecondaryColorP3uiv, (PFNGLSECONDARYCOLORP3UIVPROC)glad_counted_load("glSecondaryColorP3uiv"));
+    glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+    GLAD_PUBLISH(glad_glDrawArraysInstancedBaseInstance, (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glad_counted_load("glDrawArraysInstancedBaseInstance"));
+    glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+    GLAD_PUBLISH(glad_glDrawElementsInstancedBaseInstance, (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glad_counted_load("glDrawElementsInstancedBaseInstance"));
+    glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+    GLAD_PUBLISH(glad_glDrawElementsInstancedBaseVertexBaseInstance, (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glad_counted_load("glDrawElementsInstancedBaseVertexBaseInstance"));
+    glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY glad_lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    GLAD_PUBLISH(glad_glBufferStorage, (PFNGLBUFFERSTORAGEPROC)glad_counted_load("glBufferStorage"));
+    glad_glBufferStorage(target, size, data, flags);
+}
+static void APIENTRY glad_lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+    GLAD_PUBLISH(glad_glDrawArraysIndirect, (PFNGLDRAWARRAYSINDIRECTPROC)glad_counted_load("glDrawArraysIndirect"));
+    glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY glad_lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+    GLAD_PUBLISH(glad_glDrawElementsIndirect, (PFNGLDRAWELEMENTSINDIRECTPROC)glad_counted_load("glDrawElementsIndirect"));
+    glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY glad_lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+    GLAD_PUBLISH(glad_glGetProgramBinary, (PFNGLGETPROGRAMBINARYPROC)glad_counted_load("glGetProgramBinary"));
+    glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY glad_lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+    GLAD_PUBLISH(glad_glProgramBinary, (PFNGLPROGRAMBINARYPROC)glad_counted_load("glProgramBinary"));
+    glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY glad_lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+    GLAD_PUBLISH(glad_glProgramParameteri, (PFNGLPROGRAMPARAMETERIPROC)glad_counted_load("glProgramParameteri"));
+    glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY glad_lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    GLAD_PUBLISH(glad_glMultiDrawArraysIndirect, (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glad_counted_load("glMultiDrawArraysIndirect"));
+    glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+    GLAD_PUBLISH(glad_glMultiDrawElementsIndirect, (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glad_counted_load("glMultiDrawElementsIndirect"));
+    glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsARB(GLuint count) {
+    GLAD_PUBLISH(glad_glMaxShaderCompilerThreadsARB, (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)glad_counted_load("glMaxShaderCompilerThreadsARB"));
+    glad_glMaxShaderCompilerThreadsARB(count);
+}
+static void APIENTRY glad_lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+    GLAD_PUBLISH(glad_glDebugMessageControl, (PFNGLDEBUGMESSAGECONTROLPROC)glad_counted_load("glDebugMessageControl"));
+    glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY glad_lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+    GLAD_PUBLISH(glad_glDebugMessageInsert, (PFNGLDEBUGMESSAGEINSERTPROC)glad_counted_load("glDebugMessageInsert"));
+    glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY glad_lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+    GLAD_PUBLISH(glad_glDebugMessageCallback, (PFNGLDEBUGMESSAGECALLBACKPROC)glad_counted_load("glDebugMessageCallback"));
+    glad_glDebugMessageCallback(callback, userParam);
+}
+static GLuint APIENTRY glad_lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+    GLAD_PUBLISH(glad_glGetDebugMessageLog, (PFNGLGETDEBUGMESSAGELOGPROC)glad_counted_load("glGetDebugMessageLog"));
+    return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY glad_lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+    GLAD_PUBLISH(glad_glPushDebugGroup, (PFNGLPUSHDEBUGGROUPPROC)glad_counted_load("glPushDebugGroup"));
+    glad_glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY glad_lazy_glPopDebugGroup(void) {
+    GLAD_PUBLISH(glad_glPopDebugGroup, (PFNGLPOPDEBUGGROUPPROC)glad_counted_load("glPopDebugGroup"));
+    glad_glPopDebugGroup();
+}
+static void APIENTRY glad_lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+    GLAD_PUBLISH(glad_glObjectLabel, (PFNGLOBJECTLABELPROC)glad_counted_load("glObjectLabel"));
+    glad_glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    GLAD_PUBLISH(glad_glGetObjectLabel, (PFNGLGETOBJECTLABELPROC)glad_counted_load("glGetObjectLabel"));
+    glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+    GLAD_PUBLISH(glad_glObjectPtrLabel, (PFNGLOBJECTPTRLABELPROC)glad_counted_load("glObjectPtrLabel"));
+    glad_glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY glad_lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+    GLAD_PUBLISH(glad_glGetObjectPtrLabel, (PFNGLGETOBJECTPTRLABELPROC)glad_counted_load("glGetObjectPtrLabel"));
+    glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY glad_lazy_glGetPointerv(GLenum pname, void **params) {
+    GLAD_PUBLISH(glad_glGetPointerv, (PFNGLGETPOINTERVPROC)glad_counted_load("glGetPointerv"));
+    glad_glGetPointerv(pname, params);
+}
+static void APIENTRY glad_lazy_glMaxShaderCompilerThreadsKHR(GLuint count) {
+    GLAD_PUBLISH(glad_glMaxShaderCompilerThreadsKHR, (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)glad_counted_load("glMaxShaderCompilerThreadsKHR"));
+    glad_glMaxShaderCompilerThreadsKHR(count);
+}
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = glad_lazy_glCullFace;
+	glad_glFrontFace = glad_lazy_glFrontFace;
+	glad_glHint = glad_lazy_glHint;
+	glad_glLineWidth = glad_lazy_glLineWidth;
+	glad_glPointSize = glad_lazy_glPointSize;
+	glad_glPolygonMode = glad_lazy_glPolygonMode;
+	glad_glScissor = glad_lazy_glScissor;
+	glad_glTexParameterf = glad_lazy_glTexParameterf;
+	glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+	glad_glTexParameteri = glad_lazy_glTexParameteri;
+	glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+	glad_glTexImage1D = glad_lazy_glTexImage1D;
+	glad_glTexImage2D = glad_lazy_glTexImage2D;
+	glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+	glad_glClear = glad_lazy_glClear;
+	glad_glClearColor = glad_lazy_glClearColor;
+	glad_glClearStencil = glad_lazy_glClearStencil;
+	glad_glClearDepth = glad_lazy_glClearDepth;
+	glad_glStencilMask = glad_lazy_glStencilMask;
+	glad_glColorMask = glad_lazy_glColorMask;
+	glad_glDepthMask = glad_lazy_glDepthMask;
+	glad_glDisable = glad_lazy_glDisable;
+	glad_glEnable = glad_lazy_glEnable;
+	glad_glFinish = glad_lazy_glFinish;
+	glad_glFlush = glad_lazy_glFlush;
+	glad_glBlendFunc = glad_lazy_glBlendFunc;
+	glad_glLogicOp = glad_lazy_glLogicOp;
+	glad_glStencilFunc = glad_lazy_glStencilFunc;
+	glad_glStencilOp = glad_lazy_glStencilOp;
+	glad_glDepthFunc = glad_lazy_glDepthFunc;
+	glad_glPixelStoref = glad_lazy_glPixelStoref;
+	glad_glPixelStorei = glad_lazy_glPixelStorei;
+	glad_glReadBuffer = glad_lazy_glReadBuffer;
+	glad_glReadPixels = glad_lazy_glReadPixels;
+	glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+	glad_glGetDoublev = glad_lazy_glGetDoublev;
+	glad_glGetError = glad_lazy_glGetError;
+	glad_glGetFloatv = glad_lazy_glGetFloatv;
+	glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+	glad_glGetString = glad_lazy_glGetString;
+	glad_glGetTexImage = glad_lazy_glGetTexImage;
+	glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = glad_lazy_glIsEnabled;
+	glad_glDepthRange = glad_lazy_glDepthRange;
+	glad_glViewport = glad_lazy_glViewport;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = glad_lazy_glDrawArrays;
+	glad_glDrawElements = glad_lazy_glDrawElements;
+	glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+	glad_glBindTexture = glad_lazy_glBindTexture;
+	glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+	glad_glGenTextures = glad_lazy_glGenTextures;
+	glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+	glad_glTexImage3D = glad_lazy_glTexImage3D;
+	glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = glad_lazy_glActiveTexture;
+	glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+	glad_glPointParameterf = glad_lazy_glPointParameterf;
+	glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+	glad_glPointParameteri = glad_lazy_glPointParameteri;
+	glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+	glad_glBlendColor = glad_lazy_glBlendColor;
+	glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = glad_lazy_glGenQueries;
+	glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+	glad_glIsQuery = glad_lazy_glIsQuery;
+	glad_glBeginQuery = glad_lazy_glBeginQuery;
+	glad_glEndQuery = glad_lazy_glEndQuery;
+	glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = glad_lazy_glBindBuffer;
+	glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+	glad_glGenBuffers = glad_lazy_glGenBuffers;
+	glad_glIsBuffer = glad_lazy_glIsBuffer;
+	glad_glBufferData = glad_lazy_glBufferData;
+	glad_glBufferSubData = glad_lazy_glBufferSubData;
+	glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+	glad_glMapBuffer = glad_lazy_glMapBuffer;
+	glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+	glad_glAttachShader = glad_lazy_glAttachShader;
+	glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+	glad_glCompileShader = glad_lazy_glCompileShader;
+	glad_glCreateProgram = glad_lazy_glCreateProgram;
+	glad_glCreateShader = glad_lazy_glCreateShader;
+	glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+	glad_glDeleteShader = glad_lazy_glDeleteShader;
+	glad_glDetachShader = glad_lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+	glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+	glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+	glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+	glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = glad_lazy_glIsProgram;
+	glad_glIsShader = glad_lazy_glIsShader;
+	glad_glLinkProgram = glad_lazy_glLinkProgram;
+	glad_glShaderSource = glad_lazy_glShaderSource;
+	glad_glUseProgram = glad_lazy_glUseProgram;
+	glad_glUniform1f = glad_lazy_glUniform1f;
+	glad_glUniform2f = glad_lazy_glUniform2f;
+	glad_glUniform3f = glad_lazy_glUniform3f;
+	glad_glUniform4f = glad_lazy_glUniform4f;
+	glad_glUniform1i = glad_lazy_glUniform1i;
+	glad_glUniform2i = glad_lazy_glUniform2i;
+	glad_glUniform3i = glad_lazy_glUniform3i;
+	glad_glUniform4i = glad_lazy_glUniform4i;
+	glad_glUniform1fv = glad_lazy_glUniform1fv;
+	glad_glUniform2fv = glad_lazy_glUniform2fv;
+	glad_glUniform3fv = glad_lazy_glUniform3fv;
+	glad_glUniform4fv = glad_lazy_glUniform4fv;
+	glad_glUniform1iv = glad_lazy_glUniform1iv;
+	glad_glUniform2iv = glad_lazy_glUniform2iv;
+	glad_glUniform3iv = glad_lazy_glUniform3iv;
+	glad_glUniform4iv = glad_lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = glad_lazy_glValidateProgram;
+	glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = glad_lazy_glColorMaski;
+	glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+	glad_glEnablei = glad_lazy_glEnablei;
+	glad_glDisablei = glad_lazy_glDisablei;
+	glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = glad_lazy_glClampColor;
+	glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+	glad_glUniform1ui = glad_lazy_glUniform1ui;
+	glad_glUniform2ui = glad_lazy_glUniform2ui;
+	glad_glUniform3ui = glad_lazy_glUniform3ui;
+	glad_glUniform4ui = glad_lazy_glUniform4ui;
+	glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+	glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+	glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+	glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+	glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+	glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+	glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+	glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+	glad_glGetStringi = glad_lazy_glGetStringi;
+	glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+	glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = glad_lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+	glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+	glad_glFenceSync = glad_lazy_glFenceSync;
+	glad_glIsSync = glad_lazy_glIsSync;
+	glad_glDeleteSync = glad_lazy_glDeleteSync;
+	glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+	glad_glWaitSync = glad_lazy_glWaitSync;
+	glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+	glad_glGetSynciv = glad_lazy_glGetSynciv;
+	glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+	glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+	glad_glGenSamplers = glad_lazy_glGenSamplers;
+	glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+	glad_glIsSampler = glad_lazy_glIsSampler;
+	glad_glBindSampler = glad_lazy_glBindSampler;
+	glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+	glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+	glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+	glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+	glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+	glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+	glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+	glad_glColorP3ui = glad_lazy_glColorP3ui;
+	glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+	glad_glColorP4ui = glad_lazy_glColorP4ui;
+	glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_ARB_base_instance(void) {
+	if(!GLAD_GL_ARB_base_instance) return;
+	glad_glDrawArraysInstancedBaseInstance = glad_lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = glad_lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+}
+static void lazy_GL_ARB_buffer_storage(void) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = glad_lazy_glBufferStorage;
+}
+static void lazy_GL_ARB_draw_indirect(void) {
+	if(!GLAD_GL_ARB_draw_indirect) return;
+	glad_glDrawArraysIndirect = glad_lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = glad_lazy_glDrawElementsIndirect;
+}
+static void lazy_GL_ARB_get_program_binary(void) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = glad_lazy_glGetProgramBinary;
+	glad_glProgramBinary = glad_lazy_glProgramBinary;
+	glad_glProgramParameteri = glad_lazy_glProgramParameteri;
+}
+static void lazy_GL_ARB_multi_draw_indirect(void) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = glad_lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = glad_lazy_glMultiDrawElementsIndirect;
+}
+static void lazy_GL_ARB_parallel_shader_compile(void) {
+	if(!GLAD_GL_ARB_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsARB = glad_lazy_glMaxShaderCompilerThreadsARB;
+}
+static void lazy_GL_ARB_timer_query(void) {
+	if(!GLAD_GL_ARB_timer_query) return;
+	glad_glQueryCounter = glad_lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+}
+static void lazy_GL_KHR_debug(void) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = glad_lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = glad_lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = glad_lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = glad_lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = glad_lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = glad_lazy_glPopDebugGroup;
+	glad_glObjectLabel = glad_lazy_glObjectLabel;
+	glad_glGetObjectLabel = glad_lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = glad_lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = glad_lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = glad_lazy_glGetPointerv;
+}
+static void lazy_GL_KHR_parallel_shader_compile(void) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = glad_lazy_glMaxShaderCompilerThreadsKHR;
+}
+struct glad_ext_entry {
+    unsigned int hash;
+    const char *name;
+    int *flag;
+};
+
+/* Every extension this loader was generated with, sorted by the FNV-1a
+ * hash of its name. Each advertised extension costs one hash and a binary
+ * search, and nothing is copied or allocated. */
+static const struct glad_ext_entry glad_ext_table[] = {
+    {0x1388B8AAu, "GL_ARB_multi_draw_indirect", &GLAD_GL_ARB_multi_draw_indirect},
+    {0x16BCC48Au, "GL_ARB_get_program_binary", &GLAD_GL_ARB_get_program_binary},
+    {0x3BF10772u, "GL_KHR_parallel_shader_compile", &GLAD_GL_KHR_parallel_shader_compile},
+    {0x40892782u, "GL_KHR_debug", &GLAD_GL_KHR_debug},
+    {0x5E0C3877u, "GL_ARB_timer_query", &GLAD_GL_ARB_timer_query},
+    {0x799A971Eu, "GL_ARB_parallel_shader_compile", &GLAD_GL_ARB_parallel_shader_compile},
+    {0x89F353DBu, "GL_ARB_buffer_storage", &GLAD_GL_ARB_buffer_storage},
+    {0x993B0DA4u, "GL_ARB_base_instance", &GLAD_GL_ARB_base_instance},
+    {0xF8AC3138u, "GL_ARB_draw_indirect", &GLAD_GL_ARB_draw_indirect},
+};
+
+#define GLAD_EXT_COUNT (sizeof(glad_ext_table) / sizeof(glad_ext_table[0]))
+
+static unsigned int hash_ext(const char *ext, size_t len) {
+    unsigned int hash = 2166136261u;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= (unsigned char)ext[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void mark_ext(const char *ext, size_t len) {
+    unsigned int hash = hash_ext(ext, len);
+    size_t lo = 0, hi = GLAD_EXT_COUNT;
+
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if(glad_ext_table[mid].hash < hash) lo = mid + 1;
+        else hi = mid;
+    }
+    for(; lo < GLAD_EXT_COUNT && glad_ext_table[lo].hash == hash; lo++) {
+        const char *name = glad_ext_table[lo].name;
+        if(strncmp(name, ext, len) == 0 && name[len] == '\0') {
+            *glad_ext_table[lo].flag = 1;
+        }
+    }
+}
+
 static int find_extensionsGL(void) {
-	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
-	return 1;
+    size_t i;
+    for(i = 0; i < GLAD_EXT_COUNT; i++) {
+        *glad_ext_table[i].flag = 0;
+    }
+
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major >= 3) {
+        int index, num_exts = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts);
+        for(index = 0; index < num_exts; index++) {
+            const char *ext = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if(ext != NULL) mark_ext(ext, strlen(ext));
+        }
+        return 1;
+    }
+#endif
+
+    {
+        const char *ext = (const char *)glGetString(GL_EXTENSIONS);
+        if(ext == NULL) return 0;
+        while(*ext != '\0') {
+            size_t len = strcspn(ext, " ");
+            if(len > 0) mark_ext(ext, len);
+            ext += len;
+            if(*ext == ' ') ext++;
+        }
+    }
+    return 1;
 }
 
 static void find_coreGL(void) {
@@ -1116,6 +3280,9 @@ static void find_coreGL(void) {
 }
 
 int gladLoadGLLoader(GLADloadproc load) {
+	glad_user_load = load;
+	gladGLLookups = 0;
+	load = glad_counted_load;
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
 	if(glGetString == NULL) return 0;
@@ -1135,6 +3302,51 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_3(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_draw_indirect(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_ARB_multi_draw_indirect(load);
+	load_GL_ARB_parallel_shader_compile(load);
+	load_GL_ARB_timer_query(load);
+	load_GL_KHR_debug(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	load_GL_ARB_base_instance(load);
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	PFNGLGETSTRINGPROC resolved;
+	glad_user_load = load;
+	gladGLLookups = 0;
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)glad_counted_load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	resolved = glGetString;
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	glGetString = resolved;
+
+	if (!find_extensionsGL()) return 0;
+	lazy_GL_ARB_buffer_storage();
+	lazy_GL_ARB_draw_indirect();
+	lazy_GL_ARB_get_program_binary();
+	lazy_GL_ARB_multi_draw_indirect();
+	lazy_GL_ARB_parallel_shader_compile();
+	lazy_GL_ARB_timer_query();
+	lazy_GL_KHR_debug();
+	lazy_GL_KHR_parallel_shader_compile();
+	lazy_GL_ARB_base_instance();
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
@@ -0,0 +1,595 @@
+#include <glad/glad.h>
+
+#include "application.h"
+
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <print>
+#include <string_view>
+
+#include "deferred_release.h"
+#include "dynamic_resolution.h"
+#include "gl_capture.h"
+#include "gl_intercept.h"
+#include "job_system.h"
+#include "profile_scope.h"
+#include "render_target.h"
+#include "startup.h"
+#include "trace.h"
+#include "window.h"
+
+/*
+ * Runner Properties
+ */
+const int kDefaultWidth = 800;
+const int kDefaultHeight = 600;
+const int kDefaultWindows = 3;
+const int kBenchWarmupFrames = 60;
+// Frames per benchmark mode, and per sample when running headless
+// without --frames, since nobody can close a hidden window.
+const int kBenchFrames = 600;
+const char* kCaptureFile = "capture.glc";
+const char* kTraceFile = "trace.json";
+// How long the window size has to hold still before --offscreen
+// reallocates its target.
+const double kResizeSettleSeconds = 0.2;
+// Upscaling sharpness with --dynamic-res unless --sharpen says otherwise.
+const float kDefaultSharpness = 0.5f;
+
+const char* kRunnerOptions = R"(
+  --sample NAME     run only NAME; repeatable, defaults to all samples
+  --frames N        draw N frames per sample instead of until closed
+  --headless        render into a hidden window
+  --bench           time each sample with vsync off, then exit
+  --resolution WxH  window size, 800x600 by default
+  --windows N       windows for multi-window samples, 3 by default
+  --list            print the registered samples
+  --startup         print how long each startup phase took
+  --offscreen       render into a pooled offscreen target and blit it
+                    to the window, reporting what each resize cost
+  --msaa N          offscreen target with N samples; implies --offscreen
+  --dynamic-res MS  scale the offscreen target's resolution to keep GPU
+                    frame time within MS; implies --offscreen
+  --sharpen S       sharpen upscaled frames by S from 0 to 1; 0.5 with
+                    --dynamic-res and 0 otherwise by default
+
+  --lazy-gl         resolve GL entry points on first use
+  --gl-debug        report GL debug messages
+  --gl-stats        print per-frame GL call statistics every second
+  --trace           write a Chrome trace of every frame to trace.json
+  --capture         record the GL command stream to capture.glc
+
+Press <ESC> to move on to the next sample.
+)";
+
+namespace {
+
+struct RunnerOptions {
+  std::vector<std::string_view> samples;
+  int frames = 0;
+  int width = kDefaultWidth;
+  int height = kDefaultHeight;
+  int windows = kDefaultWindows;
+  bool headless = false;
+  bool bench = false;
+  bool list = false;
+  bool startup = false;
+  bool offscreen = false;
+  int msaa = 0;
+  // GPU budget in milliseconds for dynamic resolution; 0 is off.
+  double gpuBudget = 0;
+  // Negative until --sharpen is given.
+  float sharpness = -1;
+  bool lazy = false;
+  bool debug = false;
+  bool stats = false;
+  bool trace = false;
+  bool capture = false;
+};
+
+// A selected sample, created up front so it can preload on a worker.
+struct PreloadedSample {
+  const SampleInfo* info = nullptr;
+  std::unique_ptr<Application> app;
+  JobCounter done;
+  bool ok = false;
+};
+
+}  // namespace
+
+/*
+ * Registry
+ */
+
+static std::vector<SampleInfo>& Registry() {
+  // Function-local so registration from other translation units' static
+  // initializers never sees it unconstructed.
+  static std::vector<SampleInfo> samples;
+  return samples;
+}
+
+bool RegisterSample(const SampleInfo& info) {
+  auto& samples = Registry();
+  auto at = std::ranges::upper_bound(
+      samples, std::string_view(info.name),
+      [](std::string_view a, std::string_view b) { return a < b; },
+      [](const SampleInfo& sample) { return std::string_view(sample.name); });
+  samples.insert(at, info);
+  return true;
+}
+
+const std::vector<SampleInfo>& Samples() { return Registry(); }
+
+/*
+ * Runner
+ */
+
+class SampleRunner {
+ public:
+  SampleRunner(GLFWwindow* window, ResourceLoader* loader,
+               const RunnerOptions& options)
+      : window_(window), loader_(loader), options_(options) {
+    glfwSetWindowUserPointer(window_, this);
+    glfwSetFramebufferSizeCallback(window_, ResizeCallback);
+    glfwSetKeyCallback(window_, KeyCallback);
+
+    if (options_.offscreen) {
+      RenderTargetDesc desc;
+      desc.colorFormat = GL_RGBA8;
+      desc.depthFormat = GL_DEPTH24_STENCIL8;
+      desc.samples = options_.msaa;
+      scene_ = std::make_unique<SceneTarget>(pool_, desc,
+                                             kResizeSettleSeconds);
+      int width, height;
+      glfwGetFramebufferSize(window_, &width, &height);
+      scene_->Resize(width, height, glfwGetTime());
+      float sharpness = options_.sharpness;
+      if (sharpness < 0)
+        sharpness = options_.gpuBudget > 0 ? kDefaultSharpness : 0;
+      scene_->SetSharpness(sharpness);
+    }
+    if (options_.gpuBudget > 0) {
+      dynamic_ = std::make_unique<DynamicResolution>(options_.gpuBudget);
+      if (!dynamic_->Init()) dynamic_.reset();
+    }
+  }
+
+  ~SampleRunner() {
+    if (dynamic_) dynamic_->Release();
+    if (release_.PeakDeferredBytes() > 0) {
+      std::println("Deferred release: at most {:.1f} KiB waiting on the GPU",
+                   release_.PeakDeferredBytes() / 1024.0);
+    }
+    if (!scene_) return;
+    scene_->Release();
+    pool_.Release();
+    const RenderTargetStats& stats = pool_.Stats();
+    std::println("Render targets: {} allocated, {} reused, {:.1f} MiB "
+                 "allocated in total",
+                 stats.allocations, stats.reuses,
+                 stats.bytesAllocated / double(1 << 20));
+  }
+
+  // Runs `app` until its window is closed or the frame limit is hit.
+  // Returns false if it failed to initialize.
+  bool Run(const SampleInfo& info, std::unique_ptr<Application> app) {
+    if (!Start(info, std::move(app))) return false;
+    if (const char* usage = app_->Usage()) std::println("{}", usage);
+
+    int limit = options_.frames;
+    if (limit == 0 && options_.headless) limit = kBenchFrames;
+
+    double start = glfwGetTime();
+    double lastReport = start;
+    int reportFrames = 0;
+    for (int frame = 0; limit == 0 || frame < limit; frame++) {
+      if (glfwWindowShouldClose(window_)) break;
+      Frame(glfwGetTime() - start);
+
+      reportFrames++;
+      double now = glfwGetTime();
+      if (now - lastReport >= 1.0) {
+        std::string status = app_->Status();
+        if (dynamic_) {
+          status += std::format("{}{}x{} at {:.0f}%, GPU {:.2f}/{:.2f} ms",
+                                status.empty() ? "" : ", ",
+                                scene_->RenderWidth(), scene_->RenderHeight(),
+                                100 * dynamic_->Scale(),
+                                dynamic_->GpuMilliseconds(),
+                                dynamic_->BudgetMilliseconds());
+        }
+        if (!status.empty()) {
+          double elapsed = now - lastReport;
+          std::println("{}: {:.1f} fps, {:.2f} ms, {}", info.name,
+                       reportFrames / elapsed, 1000.0 * elapsed / reportFrames,
+                       status);
+        }
+        lastReport = now;
+        reportFrames = 0;
+      }
+    }
+
+    Stop();
+    return true;
+  }
+
+  // Draws a fixed number of frames in every bench mode of `app` with
+  // vsync off and prints the average frame time of each.
+  bool Bench(const SampleInfo& info, std::unique_ptr<Application> app) {
+    if (!Start(info, std::move(app))) return false;
+    int frames = options_.frames > 0 ? options_.frames : kBenchFrames;
+
+    for (int mode = 0; mode < app_->BenchModes(); mode++) {
+      const char* label = app_->SetBenchMode(mode);
+      double start = 0;
+      for (int frame = 0; frame < kBenchWarmupFrames + frames; frame++) {
+        if (frame == kBenchWarmupFrames) {
+          glFinish();
+          start = glfwGetTime();
+          app_->Status();
+        }
+        Frame(frame / 60.0);
+      }
+      glFinish();
+      double elapsed = glfwGetTime() - start;
+
+      std::println("{:<28} {:>10} {:8.3f} ms/frame {:8.1f} fps  {}",
+                   info.name, label, 1000.0 * elapsed / frames,
+                   frames / elapsed, app_->Status());
+    }
+
+    Stop();
+    return true;
+  }
+
+ private:
+  bool Start(const SampleInfo& info, std::unique_ptr<Application> app) {
+    glfwSetWindowTitle(window_, info.title);
+    glfwSetWindowShouldClose(window_, GLFW_FALSE);
+    ResetState();
+
+    STARTUP_PHASE("Init", info.name);
+    name_ = info.name;
+    app_ = std::move(app);
+    app_->window_ = window_;
+    app_->loader_ = loader_;
+    app_->releaseQueue_ = &release_;
+    app_->windowCount_ = options_.windows;
+    app_->headless_ = options_.headless;
+    if (!app_->Init()) {
+      std::println(stderr, "Failed to initialize {}.", info.name);
+      Stop();
+      return false;
+    }
+    return true;
+  }
+
+  void Stop() {
+    if (app_) app_->Release();
+    app_.reset();
+    // The next sample should not pay for this one's leftovers.
+    release_.Release();
+    ResetState();
+  }
+
+  void Frame(double time) {
+    if (presented_) {
+      Draw(time);
+    } else {
+      {
+        STARTUP_PHASE("First frame", name_);
+        Draw(time);
+      }
+      MarkFirstFrame();
+      presented_ = true;
+    }
+    // The fence follows the frame's last draw, so it covers everything
+    // the sample released while drawing it.
+    release_.EndFrame();
+    release_.Collect();
+    CollectGpuTrace();
+    if (options_.capture) GLCaptureFrame();
+
+    if (scene_) {
+      pool_.EndFrame();
+      ResizeReport resize;
+      if (scene_->TakeResizeReport(&resize)) {
+        std::println("Resize: {} events over {:.2f} s, {} allocations, "
+                     "{:.1f} MiB churned ({:.1f} MiB reallocating per event)",
+                     resize.events, resize.seconds, resize.allocations,
+                     resize.bytesChurned / double(1 << 20),
+                     resize.naiveBytes / double(1 << 20));
+      }
+    }
+
+    if (options_.stats) {
+      EndGLInterceptFrame();
+      if (glfwGetTime() - lastStatsReport_ >= 1.0) {
+        PrintGLFrameStats();
+        lastStatsReport_ = glfwGetTime();
+      }
+    }
+  }
+
+  // Renders, presents and polls input.
+  void Draw(double time) {
+    {
+      PROFILE_SCOPE("Frame");
+      {
+        TRACE_ZONE("Render");
+        TRACE_GPU_ZONE("Render");
+        if (dynamic_) {
+          dynamic_->BeginFrame();
+          scene_->SetRenderScale(dynamic_->Scale());
+        }
+        if (scene_) scene_->Begin(glfwGetTime());
+        app_->Render(time);
+      }
+      if (scene_) {
+        TRACE_ZONE("Present");
+        TRACE_GPU_ZONE("Present");
+        scene_->Present();
+      }
+      if (dynamic_) dynamic_->EndFrame();
+      {
+        TRACE_ZONE("Swap");
+        glfwSwapBuffers(window_);
+      }
+      {
+        TRACE_ZONE("Input");
+        glfwPollEvents();
+      }
+    }
+  }
+
+  // Puts back the state samples commonly change, so each one starts
+  // from the same context state it would get from a fresh context.
+  void ResetState() {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glUseProgram(0);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+    glClearColor(0.0, 0.0, 0.0, 0.0);
+
+    int width, height;
+    glfwGetFramebufferSize(window_, &width, &height);
+    glViewport(0, 0, width, height);
+  }
+
+  static void ResizeCallback(GLFWwindow* window, int width, int height) {
+    glViewport(0, 0, width, height);
+    auto* runner = static_cast<SampleRunner*>(glfwGetWindowUserPointer(window));
+    if (runner->scene_) runner->scene_->Resize(width, height, glfwGetTime());
+    if (runner->app_) runner->app_->Resized(width, height);
+  }
+
+  static void KeyCallback(GLFWwindow* window, int key, int, int action, int) {
+    if (action != GLFW_PRESS) return;
+    if (key == GLFW_KEY_ESCAPE) {
+      glfwSetWindowShouldClose(window, GLFW_TRUE);
+      return;
+    }
+    auto* runner = static_cast<SampleRunner*>(glfwGetWindowUserPointer(window));
+    if (runner->app_) runner->app_->KeyPressed(key);
+  }
+
+  GLFWwindow* window_;
+  ResourceLoader* loader_;
+  const RunnerOptions& options_;
+  std::unique_ptr<Application> app_;
+  const char* name_ = nullptr;
+  bool presented_ = false;
+  double lastStatsReport_ = 0;
+  DeferredReleaseQueue release_;
+  // Only used with --offscreen.
+  RenderTargetPool pool_;
+  std::unique_ptr<SceneTarget> scene_;
+  // Only used with --dynamic-res.
+  std::unique_ptr<DynamicResolution> dynamic_;
+};
+
+/*
+ * Entry Point
+ */
+
+static bool ParseArgs(int argc, char** argv, RunnerOptions* options) {
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--sample" && hasValue) {
+      options->samples.push_back(argv[++i]);
+    } else if (arg == "--frames" && hasValue) {
+      options->frames = std::max(0, std::atoi(argv[++i]));
+    } else if (arg == "--windows" && hasValue) {
+      options->windows = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--resolution" && hasValue) {
+      if (std::sscanf(argv[++i], "%dx%d", &options->width,
+                      &options->height) != 2 ||
+          options->width <= 0 || options->height <= 0) {
+        return false;
+      }
+    } else if (arg == "--headless") {
+      options->headless = true;
+    } else if (arg == "--bench") {
+      options->bench = true;
+    } else if (arg == "--list") {
+      options->list = true;
+    } else if (arg == "--startup") {
+      options->startup = true;
+    } else if (arg == "--offscreen") {
+      options->offscreen = true;
+    } else if (arg == "--msaa" && hasValue) {
+      options->msaa = std::max(0, std::atoi(argv[++i]));
+      options->offscreen = true;
+    } else if (arg == "--dynamic-res" && hasValue) {
+      options->gpuBudget = std::max(0.0, std::atof(argv[++i]));
+      options->offscreen = true;
+    } else if (arg == "--sharpen" && hasValue) {
+      options->sharpness = std::atof(argv[++i]);
+    } else if (arg == "--lazy-gl") {
+      options->lazy = true;
+    } else if (arg == "--gl-debug") {
+      options->debug = true;
+    } else if (arg == "--gl-stats") {
+      options->stats = true;
+    } else if (arg == "--trace") {
+      options->trace = true;
+    } else if (arg == "--capture") {
+      options->capture = true;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Looks up the samples named on the command line, or all of them.
+static bool SelectSamples(const RunnerOptions& options,
+                          std::vector<const SampleInfo*>* selected) {
+  for (const SampleInfo& sample : Samples()) {
+    if (options.samples.empty() ||
+        std::ranges::find(options.samples, sample.name) !=
+            options.samples.end()) {
+      selected->push_back(&sample);
+    }
+  }
+  for (std::string_view name : options.samples) {
+    if (!std::ranges::any_of(Samples(), [&](const SampleInfo& sample) {
+          return name == sample.name;
+        })) {
+      std::println(stderr, "Unknown sample {}; see --list.", name);
+      return false;
+    }
+  }
+  return true;
+}
+
+int RunSamples(int argc, char** argv) {
+  RunnerOptions options;
+  if (!ParseArgs(argc, argv, &options)) {
+    std::println(stderr, "usage: {} [options]\n{}", argv[0], kRunnerOptions);
+    return 1;
+  }
+  if (options.list) {
+    for (const SampleInfo& sample : Samples())
+      std::println("{:<28} {}", sample.name, sample.title);
+    return 0;
+  }
+  std::vector<const SampleInfo*> selected;
+  if (!SelectSamples(options, &selected)) return 1;
+
+  if (options.trace) {
+    SetTraceThreadName("Main");
+    StartTrace();
+  }
+
+  // Samples preload on the job system while this thread brings up the
+  // window, context and loader, which only it can do.
+  JobSystem* jobs;
+  {
+    STARTUP_PHASE("Start workers");
+    jobs = &Jobs();
+  }
+  std::vector<PreloadedSample> preloads(selected.size());
+  for (size_t i = 0; i < selected.size(); i++) {
+    PreloadedSample* preload = &preloads[i];
+    preload->info = selected[i];
+    preload->app = preload->info->create();
+    jobs->Run(
+        [preload] {
+          STARTUP_PHASE("Preload", preload->info->name);
+          preload->ok = preload->app->Preload();
+        },
+        &preload->done);
+  }
+
+  // One window and context for every sample, so context creation and
+  // loading GL are paid once per process.
+  {
+    STARTUP_PHASE("glfwInit");
+    InitGLFW(3, 3, GLFW_OPENGL_CORE_PROFILE, options.debug);
+  }
+  if (options.headless) glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  GLFWwindow* window;
+  {
+    STARTUP_PHASE("Create window");
+    window = glfwCreateWindow(options.width, options.height,
+                              "OpenGL Playground", NULL, NULL);
+    if (window != NULL) glfwMakeContextCurrent(window);
+  }
+  bool loaded = false;
+  if (window != NULL) {
+    STARTUP_PHASE("Load GL");
+    loaded = InitGLAD(options.lazy);
+  }
+  if (!loaded) {
+    std::println(stderr, "{}",
+                 window == NULL ? "Failed to create GLFW Window."
+                                : "Failed to initialize GLAD.");
+    // Preload jobs point into `preloads`.
+    for (PreloadedSample& preload : preloads) jobs->Wait(preload.done);
+    glfwTerminate();
+    return 1;
+  }
+  LoaderStats loader = GetLoaderStats();
+  std::println("GL loaded {} in {:.3f} ms with {} lookups",
+               options.lazy ? "lazily" : "eagerly", loader.milliseconds,
+               loader.lookups);
+
+  if (options.capture) options.capture = StartGLCapture(kCaptureFile);
+  if (options.stats) options.stats = InstallGLIntercept();
+  if (options.bench) glfwSwapInterval(0);
+
+  // A capture records one thread's command stream, so uploads stay on
+  // this thread and multi-window samples keep to the main window while
+  // capturing.
+  if (options.capture) options.windows = 1;
+  ResourceLoader uploader;
+  if (!options.capture) {
+    STARTUP_PHASE("Start loader");
+    uploader.Start(window);
+  }
+
+  bool ok = true;
+  {
+    SampleRunner runner(window, uploader.Running() ? &uploader : nullptr,
+                        options);
+    for (PreloadedSample& preload : preloads) {
+      {
+        STARTUP_PHASE("Wait for preload", preload.info->name);
+        jobs->Wait(preload.done);
+      }
+      if (!preload.ok) {
+        std::println(stderr, "Failed to preload {}.", preload.info->name);
+        ok = false;
+        continue;
+      }
+      const SampleInfo& info = *preload.info;
+      ok &= options.bench ? runner.Bench(info, std::move(preload.app))
+                          : runner.Run(info, std::move(preload.app));
+    }
+  }
+  uploader.Stop();
+  if (options.startup) PrintStartupReport();
+
+  if (options.trace) {
+    StopTrace();
+    CollectGpuTrace();
+    WriteTrace(kTraceFile);
+  }
+  ReleaseGpuTrace();
+  if (options.capture) StopGLCapture();
+  if (options.stats) UninstallGLIntercept();
+
+  glfwTerminate();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <GLFW/glfw3.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resource_loader.h"
+
+class DeferredReleaseQueue;
+
+// Base class for the samples under src/. A sample creates its GL objects
+// in Init(), draws in Render() and deletes them again in Release(); the
+// window, context, loader and frame loop belong to the runner (see
+// RunSamples below), which runs any number of samples one after another
+// on the same context.
+class Application {
+ public:
+  virtual ~Application() = default;
+
+  // Does the sample's CPU-side setup, such as reading files, decoding
+  // assets and preprocessing shaders. Runs on a job system worker while
+  // the runner creates the window and context, so it must not call GL.
+  // Returns false if the sample cannot run.
+  virtual bool Preload() { return true; }
+
+  // Creates the sample's GL objects with the context current, after
+  // Preload() has finished. Returns false if the sample cannot run;
+  // Release() is still called.
+  virtual bool Init() = 0;
+
+  // Draws one frame. `time` is in seconds since Init(); when
+  // benchmarking it advances by exactly 1/60 per frame so runs draw the
+  // same frames.
+  virtual void Render(double time) = 0;
+
+  // Deletes every GL object Init() created. The context outlives the
+  // sample, so nothing may be left behind for the next one.
+  virtual void Release() = 0;
+
+  // Called once per key press, ESC excluded.
+  virtual void KeyPressed(int /*key*/) {}
+
+  // Called after the framebuffer is resized and the viewport reset.
+  virtual void Resized(int /*width*/, int /*height*/) {}
+
+  // Printed when the sample starts outside a benchmark.
+  virtual const char* Usage() const { return nullptr; }
+
+  // Appended to the once-a-second report and to benchmark results, e.g.
+  // how many instances were drawn. Samples reset whatever they average
+  // here when it is called.
+  virtual std::string Status() { return {}; }
+
+  // Samples that compare techniques benchmark each mode separately.
+  // SetBenchMode() switches to `mode` and returns its label.
+  virtual int BenchModes() const { return 1; }
+  virtual const char* SetBenchMode(int /*mode*/) { return ""; }
+
+  GLFWwindow* Window() const { return window_; }
+
+  // Uploads on a shared context so Init() and Render() do not stall on
+  // large copies. Null when the runner has no loader thread, e.g. while
+  // capturing, in which case samples upload directly.
+  ResourceLoader* Loader() const { return loader_; }
+
+  // Holds objects released mid-frame until the GPU has finished the
+  // frames that used them. The runner fences and collects it every frame
+  // and empties it after Release(), so samples only hand objects over,
+  // e.g. through GLObjectTable::SetReleaseQueue().
+  DeferredReleaseQueue* ReleaseQueue() const { return releaseQueue_; }
+
+  // Windows requested with the runner's --windows, for samples that
+  // drive several displays, and whether they should be hidden. Always 1
+  // under --capture, which records a single thread.
+  int WindowCount() const { return windowCount_; }
+  bool Headless() const { return headless_; }
+
+ private:
+  friend class SampleRunner;
+  GLFWwindow* window_ = nullptr;
+  ResourceLoader* loader_ = nullptr;
+  DeferredReleaseQueue* releaseQueue_ = nullptr;
+  int windowCount_ = 1;
+  bool headless_ = false;
+};
+
+struct SampleInfo {
+  // Selects the sample with the runner's --sample, e.g. "1.2_Hello_Triangle".
+  const char* name;
+  const char* title;
+  std::unique_ptr<Application> (*create)();
+};
+
+// Adds a sample to the registry. Returns true so it can initialize a
+// static; use REGISTER_SAMPLE.
+bool RegisterSample(const SampleInfo& info);
+
+// Every registered sample, sorted by name.
+const std::vector<SampleInfo>& Samples();
+
+// Registers the Application subclass `type` from its translation unit.
+// Samples are built as object libraries so the linker keeps the
+// registration even though nothing refers to it.
+#define REGISTER_SAMPLE(type, name, title)                                \
+  [[maybe_unused]] static const bool type##Registered =                   \
+      RegisterSample({name, title, []() -> std::unique_ptr<Application> { \
+        return std::make_unique<type>();                                  \
+      }})
+
+// Parses the runner's command line, creates one window and context, and
+// runs the selected samples on it in order. Returns the process exit
+// code.
+//
+//   --sample NAME     run only NAME; repeatable, defaults to all samples
+//   --frames N        draw N frames per sample instead of until closed
+//   --headless        render into a hidden window
+//   --bench           time each sample with vsync off, then exit
+//   --resolution WxH  window size, 800x600 by default
+//   --windows N       windows for multi-window samples, 3 by default
+//   --list            print the registered samples
+//   --startup         print how long each startup phase took
+//   --offscreen       render through a pooled, resize-debounced target
+//   --msaa N          offscreen target with N samples
+//   --dynamic-res MS  scale resolution to keep GPU frames within MS
+//   --sharpen S       sharpen upscaled frames by S, from 0 to 1
+//
+// plus the diagnostics flags --lazy-gl, --gl-debug, --gl-stats, --trace
+// and --capture, described in --help.
+int RunSamples(int argc, char** argv);
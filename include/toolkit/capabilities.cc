@@ -0,0 +1,35 @@
+#include <glad/glad.h>
+
+#include "capabilities.h"
+
+static GLCapabilities Detect() {
+  GLCapabilities caps;
+  caps.major = GLVersion.major;
+  caps.minor = GLVersion.minor;
+
+  caps.timerQuery = GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query;
+  caps.bufferStorage = GLAD_GL_ARB_buffer_storage;
+  caps.drawIndirect = GLAD_GL_ARB_draw_indirect;
+  caps.multiDrawIndirect =
+      GLAD_GL_ARB_draw_indirect && GLAD_GL_ARB_multi_draw_indirect;
+  caps.baseInstance = GLAD_GL_ARB_base_instance;
+  caps.debugOutput = GLAD_GL_KHR_debug;
+  caps.parallelShaderCompile =
+      GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+
+  if (GLAD_GL_ARB_get_program_binary) {
+    int formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    caps.programBinary = formats > 0;
+  }
+
+  glGetIntegerv(GL_MAX_TEXTURE_SIZE, &caps.maxTextureSize);
+  glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &caps.maxVertexAttribs);
+  glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &caps.maxUniformBlockSize);
+  return caps;
+}
+
+const GLCapabilities& Capabilities() {
+  static const GLCapabilities caps = Detect();
+  return caps;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+// What the current context supports, detected once so hot paths can
+// branch on a bool instead of querying GL or scanning extension strings.
+struct GLCapabilities {
+  int major = 0;
+  int minor = 0;
+
+  // GL_TIMESTAMP and GL_TIME_ELAPSED queries (core in 3.3).
+  bool timerQuery = false;
+  // Immutable, persistently mappable buffers via glBufferStorage.
+  bool bufferStorage = false;
+  // glDraw*Indirect from a GL_DRAW_INDIRECT_BUFFER.
+  bool drawIndirect = false;
+  // glMultiDraw*Indirect.
+  bool multiDrawIndirect = false;
+  // Draws honor a base instance for instanced attributes.
+  bool baseInstance = false;
+  // glDebugMessageCallback and debug groups.
+  bool debugOutput = false;
+  // GL_COMPLETION_STATUS_KHR can be polled on shaders and programs.
+  bool parallelShaderCompile = false;
+  // glGetProgramBinary / glProgramBinary with at least one format.
+  bool programBinary = false;
+
+  int maxTextureSize = 0;
+  int maxVertexAttribs = 0;
+  int maxUniformBlockSize = 0;
+};
+
+// Returns the capabilities of the context current on the first call.
+// GLAD must already be loaded.
+const GLCapabilities& Capabilities();
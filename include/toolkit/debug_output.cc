@@ -0,0 +1,139 @@
+#include <glad/glad.h>
+
+#include "debug_output.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <print>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "capabilities.h"
+#include "profile_scope.h"
+
+namespace {
+
+struct Message {
+  GLenum severity;
+  std::string text;
+  uint64_t count = 0;
+  // Scope names are string literals, so pointers are stable keys.
+  std::map<const char*, uint64_t> scopes;
+};
+
+using MessageKey = std::tuple<GLenum, GLenum, GLuint>;
+
+std::mutex mu;
+std::map<MessageKey, Message> messages;
+
+const char* SourceName(GLenum source) {
+  switch (source) {
+    case GL_DEBUG_SOURCE_API:
+      return "api";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+      return "window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER:
+      return "shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY:
+      return "third party";
+    case GL_DEBUG_SOURCE_APPLICATION:
+      return "application";
+    default:
+      return "other";
+  }
+}
+
+const char* TypeName(GLenum type) {
+  switch (type) {
+    case GL_DEBUG_TYPE_ERROR:
+      return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+      return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+      return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY:
+      return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:
+      return "performance";
+    default:
+      return "other";
+  }
+}
+
+void APIENTRY OnDebugMessage(GLenum source, GLenum type, GLuint id,
+                             GLenum severity, GLsizei length,
+                             const GLchar* text, const void*) {
+  if (type == GL_DEBUG_TYPE_PUSH_GROUP || type == GL_DEBUG_TYPE_POP_GROUP ||
+      type == GL_DEBUG_TYPE_MARKER)
+    return;
+
+  const char* scope = ProfileScope::Current();
+  std::lock_guard lock(mu);
+  Message& message = messages[{source, type, id}];
+  if (message.count++ == 0) {
+    message.severity = severity;
+    message.text.assign(text, length < 0 ? std::char_traits<char>::length(text)
+                                         : length);
+    if (type == GL_DEBUG_TYPE_ERROR)
+      std::println(stderr, "GL error {} in {}: {}", id,
+                   scope ? scope : "(no scope)", message.text);
+  }
+  message.scopes[scope]++;
+}
+
+void PrintSection(FILE* out, const char* title,
+                  std::vector<std::pair<MessageKey, const Message*>>& rows) {
+  if (rows.empty()) return;
+  std::ranges::sort(rows, [](const auto& a, const auto& b) {
+    return a.second->count > b.second->count;
+  });
+
+  std::println(out, "{}:", title);
+  for (const auto& [key, message] : rows) {
+    auto [source, type, id] = key;
+    std::println(out, "  {:>8}x  [{} {} {}] {}", message->count,
+                 SourceName(source), TypeName(type), id, message->text);
+    for (const auto& [scope, count] : message->scopes)
+      std::println(out, "  {:>8}x    in {}", count,
+                   scope ? scope : "(no scope)");
+  }
+}
+
+}  // namespace
+
+void ReportDebugMessages(FILE* out) {
+  std::lock_guard lock(mu);
+  std::vector<std::pair<MessageKey, const Message*>> performance, other;
+  for (const auto& [key, message] : messages) {
+    auto& rows = std::get<1>(key) == GL_DEBUG_TYPE_PERFORMANCE ? performance
+                                                               : other;
+    rows.push_back({key, &message});
+  }
+
+  PrintSection(out, "Performance warnings", performance);
+  PrintSection(out, "Other GL debug messages", other);
+}
+
+bool InstallDebugOutput() {
+  int flags = 0;
+  glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+  if (!Capabilities().debugOutput || !(flags & GL_CONTEXT_FLAG_DEBUG_BIT))
+    return false;
+
+  glEnable(GL_DEBUG_OUTPUT);
+  glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  glDebugMessageCallback(OnDebugMessage, nullptr);
+  glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr,
+                        GL_TRUE);
+
+  static bool registered = false;
+  if (!registered) {
+    registered = true;
+    std::atexit([] { ReportDebugMessages(stderr); });
+  }
+  return true;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdio>
+
+// Installs a KHR_debug message callback on the current context.
+//
+// Messages are deduplicated by source, type and ID and counted per
+// ProfileScope, so a warning raised every frame shows up once with a
+// count and the scopes that triggered it. Errors are also printed the
+// first time they are seen. A ranked report is printed to stderr at
+// exit. Returns false if the context has no debug output.
+//
+// Output is made synchronous so the scope is that of the GL call that
+// raised the message. That slows GL down, which is why this is only
+// installed for debug contexts.
+bool InstallDebugOutput();
+
+// Prints performance warnings, then everything else, each ranked by how
+// often it was raised.
+void ReportDebugMessages(FILE* out);
@@ -0,0 +1,97 @@
+#include <glad/glad.h>
+
+#include "deferred_release.h"
+
+#include <algorithm>
+
+void DeferredReleaseQueue::Delete(GLObjectType type, unsigned int name,
+                                  size_t bytes) {
+  current_.push_back({type, name, bytes, 0});
+  deferredBytes_ += bytes;
+  peakDeferredBytes_ = std::max(peakDeferredBytes_, deferredBytes_);
+}
+
+void DeferredReleaseQueue::RecycleBuffer(unsigned int name, size_t bytes,
+                                         unsigned int usage) {
+  current_.push_back({GLObjectType::kBuffer, name, bytes, usage});
+  deferredBytes_ += bytes;
+  peakDeferredBytes_ = std::max(peakDeferredBytes_, deferredBytes_);
+}
+
+unsigned int DeferredReleaseQueue::AcquireBuffer(size_t bytes,
+                                                 unsigned int usage) {
+  auto it = pool_.find({bytes, usage});
+  if (it == pool_.end()) return 0;
+
+  unsigned int name = it->second;
+  pool_.erase(it);
+  pooledBytes_ -= bytes;
+  return name;
+}
+
+void DeferredReleaseQueue::EndFrame() {
+  if (current_.empty()) return;
+  batches_.push_back(
+      {glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), std::move(current_)});
+  current_.clear();
+}
+
+void DeferredReleaseQueue::Retire(std::vector<Item>& items) {
+  std::vector<unsigned int> buffers, vertexArrays, textures;
+  for (const Item& item : items) {
+    deferredBytes_ -= item.bytes;
+    if (item.usage != 0) {
+      pool_.insert({{item.bytes, item.usage}, item.name});
+      pooledBytes_ += item.bytes;
+      continue;
+    }
+    switch (item.type) {
+      case GLObjectType::kBuffer:
+        buffers.push_back(item.name);
+        break;
+      case GLObjectType::kVertexArray:
+        vertexArrays.push_back(item.name);
+        break;
+      case GLObjectType::kTexture:
+        textures.push_back(item.name);
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (!buffers.empty()) glDeleteBuffers(buffers.size(), buffers.data());
+  if (!vertexArrays.empty())
+    glDeleteVertexArrays(vertexArrays.size(), vertexArrays.data());
+  if (!textures.empty()) glDeleteTextures(textures.size(), textures.data());
+}
+
+void DeferredReleaseQueue::Collect() {
+  while (!batches_.empty()) {
+    Batch& batch = batches_.front();
+    GLenum status = glClientWaitSync((GLsync)batch.fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+      break;
+
+    glDeleteSync((GLsync)batch.fence);
+    Retire(batch.items);
+    batches_.pop_front();
+  }
+}
+
+void DeferredReleaseQueue::Release() {
+  for (Batch& batch : batches_) {
+    glDeleteSync((GLsync)batch.fence);
+    Retire(batch.items);
+  }
+  batches_.clear();
+  // Nothing is left to fence it against.
+  Retire(current_);
+  current_.clear();
+
+  std::vector<unsigned int> pooled;
+  for (const auto& [key, name] : pool_) pooled.push_back(name);
+  if (!pooled.empty()) glDeleteBuffers(pooled.size(), pooled.data());
+  pool_.clear();
+  pooledBytes_ = 0;
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "gl_object.h"
+
+// Holds GL objects the GPU may still be reading until it is done with
+// them, then deletes or recycles them.
+//
+// Deleting or re-specifying a buffer that in-flight draws still source
+// from makes the driver either wait for the GPU or shadow-copy the
+// storage. Objects released here are tagged with a fence when the frame
+// ends and only acted on once Collect() sees that fence signaled, which
+// it checks without waiting.
+class DeferredReleaseQueue {
+ public:
+  DeferredReleaseQueue() = default;
+
+  DeferredReleaseQueue(const DeferredReleaseQueue&) = delete;
+  DeferredReleaseQueue& operator=(const DeferredReleaseQueue&) = delete;
+
+  // Deletes `name` once the GPU work submitted so far has completed.
+  // `bytes` only feeds the memory statistics.
+  void Delete(GLObjectType type, unsigned int name, size_t bytes = 0);
+
+  // Makes a buffer of `bytes` bytes created with `usage` available to
+  // AcquireBuffer() once the GPU work submitted so far has completed.
+  void RecycleBuffer(unsigned int name, size_t bytes, unsigned int usage);
+
+  // Returns a recycled buffer with exactly this size and usage that the
+  // GPU no longer reads from, or 0 if there is none. Its storage can be
+  // overwritten with glBufferSubData without synchronizing.
+  unsigned int AcquireBuffer(size_t bytes, unsigned int usage);
+
+  // Fences everything released since the previous call. Call once per
+  // frame after the frame's last draw.
+  void EndFrame();
+
+  // Deletes or recycles everything whose fence has signaled. Never
+  // waits on the GPU.
+  void Collect();
+
+  // Deletes everything, pooled buffers included. Must be called while
+  // the context is still current.
+  void Release();
+
+  // Bytes released but not yet safe to touch, now and at worst.
+  size_t DeferredBytes() const { return deferredBytes_; }
+  size_t PeakDeferredBytes() const { return peakDeferredBytes_; }
+
+  // Bytes sitting in the recycling pool.
+  size_t PooledBytes() const { return pooledBytes_; }
+
+ private:
+  struct Item {
+    GLObjectType type;
+    unsigned int name;
+    size_t bytes;
+    // Recycled buffers carry their usage; 0 means delete.
+    unsigned int usage;
+  };
+
+  struct Batch {
+    void* fence;
+    std::vector<Item> items;
+  };
+
+  void Retire(std::vector<Item>& items);
+
+  std::vector<Item> current_;
+  // Oldest first. Fences signal in submission order, so collection
+  // stops at the first one still pending.
+  std::deque<Batch> batches_;
+  std::multimap<std::pair<size_t, unsigned int>, unsigned int> pool_;
+
+  size_t deferredBytes_ = 0;
+  size_t peakDeferredBytes_ = 0;
+  size_t pooledBytes_ = 0;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// One indexed draw and the state it needs.
+struct DrawItem {
+  // Coarse pass, drawn in increasing order (e.g. opaque before overlay).
+  uint8_t layer = 0;
+  unsigned int program = 0;
+  unsigned int vertexArray = 0;
+  // Caller-defined material, bound through Submit's callback.
+  uint32_t material = 0;
+  // View depth in [0, 1]; within equal state, nearer draws go first.
+  float depth = 0.0f;
+
+  unsigned int mode = 0;
+  int count = 0;
+  unsigned int indexType = 0;
+  // Byte offset into the element buffer.
+  size_t offset = 0;
+};
+
+// How many state changes the last submission made, and how many the same
+// draws would have made in the order they were added.
+struct DrawQueueStats {
+  size_t draws = 0;
+  size_t programSwitches = 0;
+  size_t vertexArraySwitches = 0;
+  size_t materialSwitches = 0;
+  size_t submissionProgramSwitches = 0;
+  size_t submissionVertexArraySwitches = 0;
+  size_t submissionMaterialSwitches = 0;
+};
+
+// Collects a frame's draws and submits them ordered by state.
+//
+// Each draw gets a 64-bit key packing, from the most significant bits,
+// layer (4 bits), program (12), vertex array (12), material (12) and
+// quantized depth (24). Sorting the keys groups draws sharing a program,
+// then a vertex array, then a material, so Submit() binds each as rarely
+// as possible. Programs, vertex arrays and materials are mapped to small
+// ids on first sight in each submission; past 4096 distinct values the
+// extra ones share an id, which only weakens the grouping.
+//
+// Keys are sorted with an LSD radix sort, one 8-bit digit per pass,
+// skipping digits every key shares.
+class DrawQueue {
+ public:
+  DrawQueue() = default;
+
+  DrawQueue(const DrawQueue&) = delete;
+  DrawQueue& operator=(const DrawQueue&) = delete;
+
+  void Add(const DrawItem& item);
+
+  // Sorts and issues every draw added since the last Submit(), then
+  // empties the queue. `bindMaterial`, if set, is called whenever the
+  // material or program changes, after both are bound, so it can set the
+  // material's uniforms on the current program.
+  void Submit(const std::function<void(uint32_t material)>& bindMaterial =
+                  nullptr);
+
+  // Switch counts of the last Submit().
+  const DrawQueueStats& Stats() const { return stats_; }
+
+  size_t Size() const { return items_.size(); }
+
+ private:
+  uint64_t MakeKey(const DrawItem& item);
+  void Sort();
+
+  std::vector<DrawItem> items_;
+  std::vector<uint64_t> keys_;
+  std::vector<uint32_t> order_;
+  // Radix sort ping-pong buffers.
+  std::vector<uint64_t> scratchKeys_;
+  std::vector<uint32_t> scratchOrder_;
+
+  std::unordered_map<unsigned int, uint32_t> programIds_;
+  std::unordered_map<unsigned int, uint32_t> vertexArrayIds_;
+  std::unordered_map<uint32_t, uint32_t> materialIds_;
+
+  DrawQueueStats stats_;
+};
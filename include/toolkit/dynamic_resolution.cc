@@ -0,0 +1,95 @@
+#include <glad/glad.h>
+
+#include "dynamic_resolution.h"
+
+#include <algorithm>
+#include <cmath>
+#include <print>
+
+#include "capabilities.h"
+
+DynamicResolution::DynamicResolution(double budgetMs, float minScale,
+                                     float maxScale)
+    : budgetMs_(budgetMs),
+      minScale_(minScale),
+      maxScale_(maxScale),
+      scale_(maxScale) {}
+
+bool DynamicResolution::Init() {
+  if (!Capabilities().timerQuery) {
+    std::println(stderr, "No timer queries; dynamic resolution disabled.");
+    return false;
+  }
+  for (Slot& slot : slots_) glGenQueries(1, &slot.query);
+  return true;
+}
+
+void DynamicResolution::BeginFrame() {
+  Slot& slot = slots_[next_];
+  if (slot.query == 0 || slot.pending) {
+    // The GPU is more than kSlots frames behind; skip timing this one.
+    active_ = -1;
+    return;
+  }
+  active_ = next_;
+  next_ = (next_ + 1) % kSlots;
+  slot.scale = scale_;
+  glBeginQuery(GL_TIME_ELAPSED, slot.query);
+}
+
+void DynamicResolution::EndFrame() {
+  if (active_ >= 0) {
+    glEndQuery(GL_TIME_ELAPSED);
+    slots_[active_].pending = true;
+  }
+  Collect();
+}
+
+void DynamicResolution::Collect() {
+  // Starting after the newest slot visits them oldest first.
+  for (int i = 0; i < kSlots; i++) {
+    Slot& slot = slots_[(next_ + i) % kSlots];
+    if (!slot.pending) continue;
+    GLint available = 0;
+    glGetQueryObjectiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+    // Queries complete in order, so later ones are not ready either.
+    if (!available) break;
+    GLuint64 nanos = 0;
+    glGetQueryObjectui64v(slot.query, GL_QUERY_RESULT, &nanos);
+    slot.pending = false;
+    Update(nanos / 1e6, slot.scale);
+  }
+}
+
+void DynamicResolution::Update(double gpuMs, float scale) {
+  gpuMs_ = gpuMs;
+  double fullMs = gpuMs / (double(scale) * scale);
+  // Follow rising costs quickly and falling ones slowly.
+  if (fullMs_ == 0)
+    fullMs_ = fullMs;
+  else
+    fullMs_ += (fullMs > fullMs_ ? 0.5 : 0.05) * (fullMs - fullMs_);
+
+  float target = std::sqrt(budgetMs_ * kHeadroom / fullMs_);
+  target = std::clamp(target, minScale_, maxScale_);
+  if (gpuMs > budgetMs_) {
+    // Over budget: drop straight to what fits this frame's cost too.
+    float fits = std::sqrt(budgetMs_ * kHeadroom / fullMs);
+    target = std::clamp(std::min(target, fits), minScale_, maxScale_);
+  }
+
+  if (target < scale_) {
+    if (scale_ - target >= kMinStep || target == minScale_) scale_ = target;
+  } else if (target - scale_ >= kMinStep || target == maxScale_) {
+    scale_ = std::min(target, scale_ + kMaxStepUp);
+  }
+}
+
+void DynamicResolution::Release() {
+  for (Slot& slot : slots_) {
+    glDeleteQueries(1, &slot.query);
+    slot = {};
+  }
+  next_ = 0;
+  active_ = -1;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+// Picks the render scale that keeps the GPU's frame time within a
+// budget, for use with SceneTarget::SetRenderScale().
+//
+// Each frame is timed with a GL_TIME_ELAPSED query. Results are read a
+// few frames later, once available, so timing never stalls the
+// pipeline. Because they arrive late, each one is remembered with the
+// scale its frame was drawn at and turned into the full-resolution cost
+// it implies, assuming cost grows with the pixel count. The next scale
+// is then the one that fits that cost into the budget with some
+// headroom: lowered at once when a frame runs over, so a load spike is
+// absorbed within a few frames, and raised only in small steps once the
+// GPU has room, so the scale does not oscillate.
+class DynamicResolution {
+ public:
+  explicit DynamicResolution(double budgetMs, float minScale = 0.5f,
+                             float maxScale = 1.0f);
+
+  DynamicResolution(const DynamicResolution&) = delete;
+  DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+  // Creates the queries. Returns false if the context has no timer
+  // queries.
+  bool Init();
+
+  // Bracket everything the GPU does for one frame, drawn at Scale().
+  void BeginFrame();
+  void EndFrame();
+
+  // Scale to draw the next frame at.
+  float Scale() const { return scale_; }
+
+  // GPU time of the newest timed frame, in milliseconds.
+  double GpuMilliseconds() const { return gpuMs_; }
+  double BudgetMilliseconds() const { return budgetMs_; }
+
+  // Deletes the queries. Must be called while the context is still
+  // current.
+  void Release();
+
+ private:
+  // Frames whose queries may be in flight at once.
+  static constexpr int kSlots = 4;
+  // Share of the budget aimed for, leaving room for frame-to-frame noise.
+  static constexpr double kHeadroom = 0.9;
+  // Largest increase per timed frame.
+  static constexpr float kMaxStepUp = 0.02f;
+  // Changes smaller than this are ignored, so the image does not shimmer
+  // between nearly identical sizes.
+  static constexpr float kMinStep = 0.01f;
+
+  struct Slot {
+    unsigned int query = 0;
+    float scale = 1;
+    bool pending = false;
+  };
+
+  // Reads every finished query, oldest first, and updates the scale.
+  void Collect();
+  void Update(double gpuMs, float scale);
+
+  double budgetMs_;
+  float minScale_, maxScale_;
+  float scale_;
+  double gpuMs_ = 0;
+  // Smoothed full-resolution frame time; 0 until the first result.
+  double fullMs_ = 0;
+
+  Slot slots_[kSlots];
+  int next_ = 0;
+  // Slot timing the current frame, or -1 if every slot was in flight.
+  int active_ = -1;
+};
@@ -0,0 +1,121 @@
+#include "file_watcher.h"
+
+#include <filesystem>
+
+#include "shader.h"
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// How long the watcher thread sleeps in poll() before checking whether
+// it has been asked to stop.
+constexpr int kPollTimeoutMs = 100;
+
+FileWatcher::FileWatcher() {
+#if defined(__linux__)
+  fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd_ >= 0)
+    thread_ = std::jthread([this](std::stop_token st) { Run(st); });
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+  if (thread_.joinable()) {
+    thread_.request_stop();
+    thread_.join();
+  }
+#if defined(__linux__)
+  if (fd_ >= 0) close(fd_);
+#endif
+}
+
+bool FileWatcher::Watch(const std::string& path) {
+  std::string key = fs::absolute(path).lexically_normal().string();
+  {
+    std::lock_guard lock(mu_);
+    if (files_.contains(key)) return true;
+  }
+
+  std::string contents;
+  if (!ReadFile(path, &contents)) return false;
+
+  std::lock_guard lock(mu_);
+#if defined(__linux__)
+  if (fd_ >= 0) {
+    std::string dir = fs::path(key).parent_path().string();
+    int wd = inotify_add_watch(fd_, dir.c_str(),
+                               IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (wd >= 0) dirs_[wd] = dir;
+  }
+#endif
+  Entry& entry = files_[key];
+  if (entry.version == 0) {
+    entry.version = 1;
+    entry.contents = std::move(contents);
+  }
+  return true;
+}
+
+bool FileWatcher::Latest(const std::string& path, uint64_t* version,
+                         std::string* out) {
+  std::string key = fs::absolute(path).lexically_normal().string();
+  std::lock_guard lock(mu_);
+  auto it = files_.find(key);
+  if (it == files_.end() || it->second.version <= *version) return false;
+
+  *version = it->second.version;
+  *out = it->second.contents;
+  return true;
+}
+
+void FileWatcher::Reload(const std::string& path) {
+  {
+    std::lock_guard lock(mu_);
+    if (!files_.contains(path)) return;
+  }
+
+  // Read outside the lock so Latest() never waits on the disk. A failed
+  // read is most likely a save in progress; the next event retries.
+  std::string contents;
+  if (!ReadFile(path, &contents)) return;
+
+  std::lock_guard lock(mu_);
+  Entry& entry = files_[path];
+  if (entry.contents == contents) return;
+  entry.contents = std::move(contents);
+  entry.version++;
+}
+
+void FileWatcher::Run(std::stop_token stop) {
+#if defined(__linux__)
+  alignas(inotify_event) char buffer[4096];
+  pollfd pfd = {fd_, POLLIN, 0};
+
+  while (!stop.stop_requested()) {
+    if (poll(&pfd, 1, kPollTimeoutMs) <= 0) continue;
+
+    ssize_t len;
+    while ((len = read(fd_, buffer, sizeof(buffer))) > 0) {
+      for (char* p = buffer; p < buffer + len;) {
+        auto* event = reinterpret_cast<inotify_event*>(p);
+        p += sizeof(inotify_event) + event->len;
+        if (event->len == 0) continue;
+
+        std::string dir;
+        {
+          std::lock_guard lock(mu_);
+          auto it = dirs_.find(event->wd);
+          if (it == dirs_.end()) continue;
+          dir = it->second;
+        }
+        Reload((fs::path(dir) / event->name).string());
+      }
+    }
+  }
+#endif
+}
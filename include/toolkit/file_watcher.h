@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Watches files for modification on a background thread and keeps the
+// latest contents of each one in memory. Consumers poll with Latest(),
+// which never blocks on I/O, so it is safe to call from the frame loop.
+//
+// Directories are watched rather than the files themselves so editors
+// that save by renaming a temporary file over the original are picked
+// up. Only implemented with inotify; elsewhere files are read once and
+// never reported as changed.
+class FileWatcher {
+ public:
+  FileWatcher();
+  ~FileWatcher();
+
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+
+  // Starts watching `path` and reads its current contents. Returns false
+  // if the file could not be read.
+  bool Watch(const std::string& path);
+
+  // Copies the contents of `path` into `out` if they changed after
+  // `*version`, and updates `*version`. Returns false when there is
+  // nothing new.
+  bool Latest(const std::string& path, uint64_t* version, std::string* out);
+
+ private:
+  struct Entry {
+    uint64_t version = 0;
+    std::string contents;
+  };
+
+  void Run(std::stop_token stop);
+  void Reload(const std::string& path);
+
+  int fd_ = -1;
+  std::mutex mu_;
+  std::unordered_map<int, std::string> dirs_;
+  std::unordered_map<std::string, Entry> files_;
+  std::jthread thread_;
+};
@@ -0,0 +1,153 @@
+#include "frame_arena.h"
+
+#include <algorithm>
+#include <new>
+#include <print>
+
+// Bytes a thread takes from the frame block at a time. Requests larger
+// than a quarter of this skip the chunk and bump the block directly.
+constexpr size_t kChunkBytes = 64 * 1024;
+// Block alignment; larger alignments go to the heap.
+constexpr size_t kBlockAlignment = 64;
+
+// Ids distinguishing arenas, so a chunk cached for a destroyed arena is
+// never mistaken for one of a new arena at the same address.
+static std::atomic<uint64_t> gNextArenaId = 1;
+
+// Arenas a thread keeps a chunk cached for at once, so several live
+// arenas do not evict each other's chunks. Beyond this, the entry
+// claimed longest ago is abandoned.
+constexpr int kCachedArenas = 4;
+
+// The chunk the current thread is bump-allocating from in one arena.
+struct ThreadChunk {
+  uint64_t arena = 0;
+  uint64_t frame = 0;
+  char* cursor = nullptr;
+  char* end = nullptr;
+};
+struct ThreadChunks {
+  ThreadChunk chunks[kCachedArenas];
+  // Next entry to replace when an uncached arena needs one.
+  int victim = 0;
+};
+static thread_local ThreadChunks tChunks;
+
+// The current thread's entry for arena `id`, claiming one if it has none.
+static ThreadChunk& ChunkFor(uint64_t id) {
+  ThreadChunks& cache = tChunks;
+  for (ThreadChunk& chunk : cache.chunks) {
+    if (chunk.arena == id) return chunk;
+  }
+  ThreadChunk& chunk = cache.chunks[cache.victim];
+  cache.victim = (cache.victim + 1) % kCachedArenas;
+  chunk = {id};
+  return chunk;
+}
+
+static size_t AlignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+FrameArena::FrameArena(size_t bytesPerFrame, int frames)
+    : capacity_(AlignUp(bytesPerFrame, kBlockAlignment)),
+      blocks_(new Block[std::max(frames, 1)]),
+      blockCount_(std::max(frames, 1)),
+      id_(gNextArenaId.fetch_add(1, std::memory_order_relaxed)) {
+  for (int i = 0; i < blockCount_; i++) {
+    blocks_[i].base = static_cast<char*>(
+        ::operator new(capacity_, std::align_val_t(kBlockAlignment)));
+  }
+}
+
+FrameArena::~FrameArena() {
+  for (int i = 0; i < blockCount_; i++) {
+    Reset(blocks_[i]);
+    ::operator delete(blocks_[i].base, std::align_val_t(kBlockAlignment));
+  }
+}
+
+void* FrameArena::Allocate(size_t bytes, size_t alignment) {
+  bytes = std::max<size_t>(bytes, 1);
+  Block& block = blocks_[current_];
+  if (alignment > kBlockAlignment)
+    return AllocateOverflow(block, bytes, alignment);
+
+  if (bytes <= kChunkBytes / 4) {
+    ThreadChunk& chunk = ChunkFor(id_);
+    if (chunk.frame == frame_ && chunk.cursor) {
+      size_t offset = AlignUp(chunk.cursor - block.base, alignment);
+      if (offset + bytes <= size_t(chunk.end - block.base)) {
+        chunk.cursor = block.base + offset + bytes;
+        return block.base + offset;
+      }
+    }
+
+    // Whatever is left of the old chunk is abandoned.
+    if (char* fresh = Bump(block, kChunkBytes, kBlockAlignment)) {
+      chunk = {id_, frame_, fresh + bytes, fresh + kChunkBytes};
+      return fresh;
+    }
+  }
+
+  if (char* memory = Bump(block, bytes, alignment)) return memory;
+  return AllocateOverflow(block, bytes, alignment);
+}
+
+char* FrameArena::Bump(Block& block, size_t bytes, size_t alignment) {
+  size_t offset = block.offset.load(std::memory_order_relaxed);
+  size_t aligned;
+  do {
+    aligned = AlignUp(offset, alignment);
+    if (aligned + bytes > capacity_) return nullptr;
+  } while (!block.offset.compare_exchange_weak(offset, aligned + bytes,
+                                               std::memory_order_relaxed));
+  return block.base + aligned;
+}
+
+void* FrameArena::AllocateOverflow(Block& block, size_t bytes,
+                                   size_t alignment) {
+  void* memory = ::operator new(bytes, std::align_val_t(alignment));
+  std::lock_guard lock(overflowMutex_);
+  block.overflows.push_back({memory, alignment});
+  block.overflowBytes += bytes;
+  overflowCount_++;
+  return memory;
+}
+
+void FrameArena::EndFrame() {
+  highWater_ = std::max(highWater_, Used());
+  peakOverflowBytes_ =
+      std::max(peakOverflowBytes_, blocks_[current_].overflowBytes);
+
+  current_ = (current_ + 1) % blockCount_;
+  frame_++;
+  Reset(blocks_[current_]);
+}
+
+void FrameArena::Reset(Block& block) {
+  for (const Overflow& overflow : block.overflows) {
+    ::operator delete(overflow.memory, std::align_val_t(overflow.alignment));
+  }
+  block.overflows.clear();
+  block.overflowBytes = 0;
+  block.offset.store(0, std::memory_order_relaxed);
+}
+
+size_t FrameArena::Used() const {
+  const Block& block = blocks_[current_];
+  return std::min(block.offset.load(std::memory_order_relaxed), capacity_) +
+         block.overflowBytes;
+}
+
+void FrameArena::Report(FILE* out) const {
+  std::println(out, "Frame arena: {} of {} KiB per frame at peak ({:.1f}%)",
+               highWater_ / 1024, capacity_ / 1024,
+               100.0 * highWater_ / capacity_);
+  if (overflowCount_ > 0) {
+    std::println(out,
+                 "  {} allocations spilled to the heap, up to {} KiB in a "
+                 "frame; raise the per-frame size",
+                 overflowCount_, peakOverflowBytes_ / 1024);
+  }
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+// Bump allocator for data that lives for a frame or two, such as draw
+// lists, sort keys and command buffers.
+//
+// Memory is reserved up front for `frames` frames. Allocations come from
+// the current frame's block; EndFrame() moves to the next block and
+// resets it in O(1), so data allocated in a frame stays valid until
+// EndFrame() has been called `frames` times, long enough for the GPU to
+// consume it with double or triple buffering. Nothing is freed
+// individually.
+//
+// Each thread carves fixed chunks out of the block with one atomic add
+// and bump-allocates inside them without synchronizing, so workers can
+// build lists in parallel. Requests that do not fit fall back to the heap
+// until that frame is reset, and are counted in Report().
+//
+// EndFrame() must not run while other threads are allocating.
+class FrameArena {
+ public:
+  explicit FrameArena(size_t bytesPerFrame, int frames = 3);
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  ~FrameArena();
+
+  void* Allocate(size_t bytes,
+                 size_t alignment = alignof(std::max_align_t));
+
+  // Uninitialized storage for `count` objects of type T.
+  template <typename T>
+  T* AllocateArray(size_t count) {
+    return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+  }
+
+  // Finishes the current frame and resets the oldest block for the next.
+  void EndFrame();
+
+  // Memory resource allocating from this arena, for std::pmr containers
+  // such as `std::pmr::vector<T> list(arena.Resource())`. Deallocation is
+  // a no-op; memory returns when the frame is reset.
+  std::pmr::memory_resource* Resource() { return &resource_; }
+
+  // Bytes taken from the current frame so far, including heap fallbacks.
+  size_t Used() const;
+  // Most bytes any finished frame used.
+  size_t HighWater() const { return highWater_; }
+  size_t Capacity() const { return capacity_; }
+
+  // Prints the high-water mark against the per-frame capacity, and how
+  // often allocations spilled to the heap.
+  void Report(FILE* out = stdout) const;
+
+ private:
+  class ArenaResource final : public std::pmr::memory_resource {
+   public:
+    explicit ArenaResource(FrameArena& arena) : arena_(arena) {}
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+      return arena_.Allocate(bytes, alignment);
+    }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    FrameArena& arena_;
+  };
+
+  struct Overflow {
+    void* memory;
+    size_t alignment;
+  };
+
+  struct Block {
+    char* base = nullptr;
+    std::atomic<size_t> offset = 0;
+    std::vector<Overflow> overflows;
+    size_t overflowBytes = 0;
+  };
+
+  char* Bump(Block& block, size_t bytes, size_t alignment);
+  void* AllocateOverflow(Block& block, size_t bytes, size_t alignment);
+  void Reset(Block& block);
+
+  size_t capacity_;
+  std::unique_ptr<Block[]> blocks_;
+  int blockCount_;
+  int current_ = 0;
+  // Identifies this arena and frame to threads' cached chunks.
+  uint64_t id_;
+  uint64_t frame_ = 0;
+
+  std::mutex overflowMutex_;
+
+  size_t highWater_ = 0;
+  uint64_t overflowCount_ = 0;
+  size_t peakOverflowBytes_ = 0;
+
+  ArenaResource resource_{*this};
+};
@@ -0,0 +1,270 @@
+#include "frustum_cull.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
+
+#include "parallel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TOOLKIT_X86 1
+#endif
+
+// Volumes per range. Ranges are fixed so survivors merge back in their
+// original order regardless of how the ranges were spread over threads.
+constexpr size_t kRangeSize = 16384;
+
+namespace {
+
+// One plane and the component arrays to test it against. For boxes these
+// are the corner furthest along the plane's normal.
+struct PlaneInput {
+  float a, b, c, d;
+  const float* x;
+  const float* y;
+  const float* z;
+};
+
+struct KernelInput {
+  PlaneInput planes[6];
+  // Null for boxes, which test their corner against zero distance.
+  const float* radius;
+};
+
+// Writes the indices in [begin, end) that pass all six planes to `out`
+// and returns how many there are. `out` must hold end - begin entries.
+using Kernel = size_t (*)(const KernelInput& in, size_t begin, size_t end,
+                          uint32_t* out);
+
+}  // namespace
+
+static size_t CullScalar(const KernelInput& in, size_t begin, size_t end,
+                         uint32_t* out) {
+  size_t n = 0;
+  for (size_t i = begin; i < end; i++) {
+    float r = in.radius ? in.radius[i] : 0.0f;
+    bool inside = true;
+    for (const PlaneInput& p : in.planes) {
+      if (p.a * p.x[i] + p.b * p.y[i] + p.c * p.z[i] + p.d + r < 0.0f) {
+        inside = false;
+        break;
+      }
+    }
+    if (inside) out[n++] = i;
+  }
+  return n;
+}
+
+#ifdef TOOLKIT_X86
+__attribute__((target("avx2,fma"))) static size_t CullAvx2(
+    const KernelInput& in, size_t begin, size_t end, uint32_t* out) {
+  __m256 a[6], b[6], c[6], d[6];
+  for (int p = 0; p < 6; p++) {
+    a[p] = _mm256_set1_ps(in.planes[p].a);
+    b[p] = _mm256_set1_ps(in.planes[p].b);
+    c[p] = _mm256_set1_ps(in.planes[p].c);
+    d[p] = _mm256_set1_ps(in.planes[p].d);
+  }
+  const __m256 zero = _mm256_setzero_ps();
+
+  size_t n = 0, i = begin;
+  for (; i + 8 <= end; i += 8) {
+    __m256 r = in.radius ? _mm256_loadu_ps(in.radius + i) : zero;
+    __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (int p = 0; p < 6; p++) {
+      const PlaneInput& plane = in.planes[p];
+      __m256 dist = _mm256_add_ps(d[p], r);
+      dist = _mm256_fmadd_ps(a[p], _mm256_loadu_ps(plane.x + i), dist);
+      dist = _mm256_fmadd_ps(b[p], _mm256_loadu_ps(plane.y + i), dist);
+      dist = _mm256_fmadd_ps(c[p], _mm256_loadu_ps(plane.z + i), dist);
+      inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, zero, _CMP_GE_OQ));
+    }
+
+    unsigned int mask = _mm256_movemask_ps(inside);
+    while (mask) {
+      out[n++] = i + __builtin_ctz(mask);
+      mask &= mask - 1;
+    }
+  }
+  return n + CullScalar(in, i, end, out + n);
+}
+
+__attribute__((target("avx512f"))) static size_t CullAvx512(
+    const KernelInput& in, size_t begin, size_t end, uint32_t* out) {
+  __m512 a[6], b[6], c[6], d[6];
+  for (int p = 0; p < 6; p++) {
+    a[p] = _mm512_set1_ps(in.planes[p].a);
+    b[p] = _mm512_set1_ps(in.planes[p].b);
+    c[p] = _mm512_set1_ps(in.planes[p].c);
+    d[p] = _mm512_set1_ps(in.planes[p].d);
+  }
+  const __m512 zero = _mm512_setzero_ps();
+  const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                          11, 12, 13, 14, 15);
+
+  size_t n = 0, i = begin;
+  for (; i + 16 <= end; i += 16) {
+    __m512 r = in.radius ? _mm512_loadu_ps(in.radius + i) : zero;
+    __mmask16 inside = 0xFFFF;
+    for (int p = 0; p < 6; p++) {
+      const PlaneInput& plane = in.planes[p];
+      __m512 dist = _mm512_add_ps(d[p], r);
+      dist = _mm512_fmadd_ps(a[p], _mm512_loadu_ps(plane.x + i), dist);
+      dist = _mm512_fmadd_ps(b[p], _mm512_loadu_ps(plane.y + i), dist);
+      dist = _mm512_fmadd_ps(c[p], _mm512_loadu_ps(plane.z + i), dist);
+      inside = _mm512_mask_cmp_ps_mask(inside, dist, zero, _CMP_GE_OQ);
+    }
+
+    // Compress in a register and store all sixteen lanes: n never runs
+    // ahead of i - begin, so the extra lanes stay inside `out` and are
+    // overwritten by later iterations. This avoids compress-to-memory,
+    // which is slow on some CPUs.
+    __m512i indices = _mm512_add_epi32(_mm512_set1_epi32(i), lanes);
+    _mm512_storeu_si512(out + n, _mm512_maskz_compress_epi32(inside, indices));
+    n += __builtin_popcount(inside);
+  }
+  return n + CullScalar(in, i, end, out + n);
+}
+#endif
+
+static Kernel KernelFor(CullPath path) {
+#ifdef TOOLKIT_X86
+  switch (path) {
+    case CullPath::kAvx512:
+      return CullAvx512;
+    case CullPath::kAvx2:
+      return CullAvx2;
+    default:
+      break;
+  }
+#endif
+  return CullScalar;
+}
+
+static void CullRanges(Kernel kernel, bool threaded,
+                       std::vector<std::vector<uint32_t>>& ranges,
+                       std::pmr::memory_resource* scratch,
+                       const KernelInput& input, size_t count,
+                       std::vector<uint32_t>* visible) {
+  size_t rangeCount = (count + kRangeSize - 1) / kRangeSize;
+  if (ranges.size() < rangeCount) ranges.resize(rangeCount);
+
+  std::pmr::vector<size_t> survivors(rangeCount, scratch);
+  auto cull = [&](size_t first, size_t last) {
+    for (size_t r = first; r < last; r++) {
+      size_t begin = r * kRangeSize;
+      size_t end = std::min(begin + kRangeSize, count);
+      ranges[r].resize(end - begin);
+      survivors[r] = kernel(input, begin, end, ranges[r].data());
+    }
+  };
+  if (threaded) {
+    ParallelFor(rangeCount, 1, cull);
+  } else {
+    cull(0, rangeCount);
+  }
+
+  std::pmr::vector<size_t> offsets(rangeCount + 1, 0, scratch);
+  for (size_t r = 0; r < rangeCount; r++)
+    offsets[r + 1] = offsets[r] + survivors[r];
+  visible->resize(offsets[rangeCount]);
+
+  uint32_t* out = visible->data();
+  auto merge = [&](size_t first, size_t last) {
+    for (size_t r = first; r < last; r++) {
+      std::memcpy(out + offsets[r], ranges[r].data(),
+                  survivors[r] * sizeof(uint32_t));
+    }
+  };
+  if (threaded) {
+    ParallelFor(rangeCount, 8, merge);
+  } else {
+    merge(0, rangeCount);
+  }
+}
+
+void BoundingSpheres::resize(size_t count) {
+  x.resize(count);
+  y.resize(count);
+  z.resize(count);
+  radius.resize(count);
+}
+
+void BoundingBoxes::resize(size_t count) {
+  minX.resize(count);
+  minY.resize(count);
+  minZ.resize(count);
+  maxX.resize(count);
+  maxY.resize(count);
+  maxZ.resize(count);
+}
+
+CullPath BestCullPath() {
+#ifdef TOOLKIT_X86
+  if (__builtin_cpu_supports("avx512f")) return CullPath::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return CullPath::kAvx2;
+#endif
+  return CullPath::kScalar;
+}
+
+const char* CullPathName(CullPath path) {
+  switch (path) {
+    case CullPath::kAvx512:
+      return "AVX-512";
+    case CullPath::kAvx2:
+      return "AVX2";
+    default:
+      return "scalar";
+  }
+}
+
+FrustumCuller::FrustumCuller(CullPath path)
+    : path_(std::min(path, BestCullPath())),
+      scratch_(kScratchBytes, /*frames=*/1) {}
+
+void FrustumCuller::Cull(const BoundingSpheres& spheres,
+                         const float planes[6][4],
+                         std::vector<uint32_t>* visible) {
+  KernelInput input;
+  for (int p = 0; p < 6; p++) {
+    const float* n = planes[p];
+    input.planes[p] = {n[0],
+                       n[1],
+                       n[2],
+                       n[3],
+                       spheres.x.data(),
+                       spheres.y.data(),
+                       spheres.z.data()};
+  }
+  input.radius = spheres.radius.data();
+  // The previous call's scratch is dead by now.
+  scratch_.EndFrame();
+  CullRanges(KernelFor(path_), threaded_, ranges_, scratch_.Resource(), input,
+             spheres.size(), visible);
+}
+
+void FrustumCuller::Cull(const BoundingBoxes& boxes, const float planes[6][4],
+                         std::vector<uint32_t>* visible) {
+  // A box is outside a plane exactly when its corner furthest along the
+  // normal is, and which corner that is only depends on the plane's
+  // signs, so each plane reads one min or max array per axis.
+  KernelInput input;
+  for (int p = 0; p < 6; p++) {
+    const float* n = planes[p];
+    input.planes[p] = {
+        n[0],
+        n[1],
+        n[2],
+        n[3],
+        n[0] >= 0 ? boxes.maxX.data() : boxes.minX.data(),
+        n[1] >= 0 ? boxes.maxY.data() : boxes.minY.data(),
+        n[2] >= 0 ? boxes.maxZ.data() : boxes.minZ.data(),
+    };
+  }
+  input.radius = nullptr;
+  scratch_.EndFrame();
+  CullRanges(KernelFor(path_), threaded_, ranges_, scratch_.Resource(), input,
+             boxes.size(), visible);
+}
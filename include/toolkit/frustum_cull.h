@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "frame_arena.h"
+
+// Bounding spheres stored as structure-of-arrays, so eight or sixteen of
+// them load into one SIMD register per component.
+struct BoundingSpheres {
+  std::vector<float> x, y, z, radius;
+
+  size_t size() const { return x.size(); }
+  void resize(size_t count);
+};
+
+// Axis-aligned boxes stored as structure-of-arrays.
+struct BoundingBoxes {
+  std::vector<float> minX, minY, minZ;
+  std::vector<float> maxX, maxY, maxZ;
+
+  size_t size() const { return minX.size(); }
+  void resize(size_t count);
+};
+
+// Instruction set a FrustumCuller tests with.
+enum class CullPath { kScalar, kAvx2, kAvx512 };
+
+// Widest path the running CPU supports.
+CullPath BestCullPath();
+
+const char* CullPathName(CullPath path);
+
+// Culls bounding volumes against a frustum on the CPU.
+//
+// Each iteration tests eight (AVX2) or sixteen (AVX-512) volumes against
+// all six planes; the path is chosen at runtime so one binary runs on any
+// x86-64 CPU, with a scalar loop elsewhere. Volumes are split into fixed
+// ranges culled across worker threads, and the survivors are written to
+// a compact index list in their original order, ready to fill an
+// instance buffer or indirect draw list.
+class FrustumCuller {
+ public:
+  explicit FrustumCuller(CullPath path = BestCullPath());
+
+  // Replaces `visible` with the indices of the spheres that intersect the
+  // frustum. Planes are (a, b, c, d) keeping points where
+  // a*x + b*y + c*z + d >= 0, as ExtractFrustumPlanes produces.
+  void Cull(const BoundingSpheres& spheres, const float planes[6][4],
+            std::vector<uint32_t>* visible);
+
+  // Same for boxes. A box is kept unless it lies entirely outside one
+  // plane, so large boxes near frustum corners may pass.
+  void Cull(const BoundingBoxes& boxes, const float planes[6][4],
+            std::vector<uint32_t>* visible);
+
+  // Culls on the calling thread only, for measuring per-core cost.
+  void SetThreaded(bool threaded) { threaded_ = threaded; }
+
+  CullPath path() const { return path_; }
+
+ private:
+  // One thread chunk. Each range takes two size_t, so this covers 64M
+  // volumes before spilling to the heap.
+  static constexpr size_t kScratchBytes = 64 << 10;
+
+  CullPath path_;
+  bool threaded_ = true;
+  // Survivors of each range, merged into the output afterwards.
+  std::vector<std::vector<uint32_t>> ranges_;
+  // Per-call survivor counts and output offsets, reset by each Cull()
+  // instead of going through the heap.
+  FrameArena scratch_;
+};
@@ -0,0 +1,459 @@
+#include <glad/glad.h>
+
+#include "gl_capture.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <print>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "gl_capture_ops.h"
+#include "gl_format.h"
+
+// stdio buffer for the trace file.
+constexpr size_t kWriteBuffer = 1 << 20;
+
+static FILE* gOut = nullptr;
+static uint64_t gFrames = 0;
+static uint64_t gBytes = 0;
+static std::vector<void (*)()> gUninstallers;
+
+// Capture-side state needed to size client memory arguments.
+static GLint gUnpackAlignment = 4;
+static GLuint gUnpackBuffer = 0;
+
+// A range mapped with glMapBufferRange, keyed by target.
+struct MappedRange {
+  uint8_t* memory;
+  GLintptr offset;
+  GLsizeiptr length;
+  GLbitfield access;
+};
+static std::unordered_map<GLenum, MappedRange> gMapped;
+// Contents of the range being unmapped.
+static std::vector<uint8_t> gUnmapped;
+
+/*
+ * Writing
+ */
+
+static void Write(const void* data, size_t size) {
+  if (!gOut) return;
+  std::fwrite(data, 1, size, gOut);
+  gBytes += size;
+}
+
+static void WriteOp(GLOp op) {
+  uint16_t code = static_cast<uint16_t>(op);
+  Write(&code, sizeof(code));
+}
+
+// Scalars are written raw; pointers as 64-bit values.
+template <typename T>
+static void WriteValue(T value) {
+  if constexpr (std::is_pointer_v<T>) {
+    uint64_t address = reinterpret_cast<uintptr_t>(value);
+    Write(&address, sizeof(address));
+  } else {
+    Write(&value, sizeof(value));
+  }
+}
+
+static void WriteBlob(const void* data, uint64_t size) {
+  if (!data) size = 0;
+  WriteValue(size);
+  Write(data, size);
+}
+
+static void WriteNames(GLsizei n, const GLuint* names) {
+  WriteValue(n);
+  Write(names, n * sizeof(GLuint));
+}
+
+/*
+ * Hooks
+ */
+
+// Function that records a call: given the result first, if any, then the
+// arguments.
+template <typename R, typename... A>
+struct RecorderOf {
+  using Type = void (*)(R, A...);
+};
+template <typename... A>
+struct RecorderOf<void, A...> {
+  using Type = void (*)(A...);
+};
+
+// Swaps the glad pointer `Slot` for a wrapper. The recorder writes the
+// call after the original runs, so outputs such as generated names are
+// available; an optional `before` hook sees the arguments first. As in
+// gl_intercept.cc, a glad lazy trampoline replacing the slot during the
+// call is adopted as the new original.
+template <auto* Slot, typename Fn = std::remove_pointer_t<decltype(Slot)>>
+struct CaptureHook;
+
+template <auto* Slot, typename R, typename... A>
+struct CaptureHook<Slot, R(APIENTRYP)(A...)> {
+  using Fn = R(APIENTRYP)(A...);
+  using Recorder = typename RecorderOf<R, A...>::Type;
+
+  // Atomic for the same reason as in gl_intercept.cc.
+  static inline std::atomic<Fn> original = nullptr;
+  static inline Recorder record = nullptr;
+  static inline void (*before)(A...) = nullptr;
+
+  static R APIENTRY Call(A... args) {
+    if (before) before(args...);
+    Fn hooked = SlotRef().load(std::memory_order_acquire);
+    Fn call = original.load(std::memory_order_acquire);
+    if constexpr (std::is_void_v<R>) {
+      call(args...);
+      Heal(hooked);
+      record(args...);
+    } else {
+      R result = call(args...);
+      Heal(hooked);
+      record(result, args...);
+      return result;
+    }
+  }
+
+  static std::atomic_ref<Fn> SlotRef() { return std::atomic_ref<Fn>(*Slot); }
+
+  static void Heal(Fn hooked) {
+    Fn resolved = SlotRef().load(std::memory_order_acquire);
+    if (resolved != hooked) {
+      original.store(resolved, std::memory_order_release);
+      SlotRef().store(hooked, std::memory_order_release);
+    }
+  }
+
+  static void Install(Recorder recorder,
+                      void (*beforeCall)(A...) = nullptr) {
+    if (!*Slot || *Slot == Call) return;
+    record = recorder;
+    before = beforeCall;
+    original.store(*Slot, std::memory_order_release);
+    SlotRef().store(Call, std::memory_order_release);
+    gUninstallers.push_back([] {
+      Fn expected = Call;
+      SlotRef().compare_exchange_strong(expected, original.load());
+    });
+  }
+};
+
+// Records every argument as a raw value.
+template <GLOp Op, auto* Slot,
+          typename Fn = std::remove_pointer_t<decltype(Slot)>>
+struct GenericRecord;
+
+template <GLOp Op, auto* Slot, typename R, typename... A>
+struct GenericRecord<Op, Slot, R(APIENTRYP)(A...)> {
+  static void Record(A... args) {
+    WriteOp(Op);
+    (WriteValue(args), ...);
+  }
+};
+
+// `fn` names glad's macro for the entry point, so it expands to the
+// glad_ function pointer both here and in GLOp.
+#define CAPTURE(fn) CaptureHook<&fn>::Install
+#define CAPTURE_GENERIC(fn, kinds) \
+  CAPTURE(fn)(GenericRecord<GLOp::fn, &fn>::Record);
+#define CAPTURE_NONE(fn)
+
+static void InstallGenericHooks() {
+  GL_CAPTURE_OPS(CAPTURE_GENERIC, CAPTURE_NONE)
+}
+
+static void RecordGen(GLOp op, GLsizei n, const GLuint* names) {
+  WriteOp(op);
+  WriteNames(n, names);
+}
+
+// Bytes of client pixel data a texture upload reads. Every row but the
+// last is padded to the unpack alignment; GL stops reading at the end of
+// the last row's texels. Row length and skip parameters are not handled.
+static uint64_t UploadBytes(GLsizei width, GLsizei height, GLenum format,
+                            GLenum type) {
+  if (width <= 0 || height <= 0) return 0;
+  uint64_t row = GLTexelBytes(format, type) * width;
+  uint64_t alignment = gUnpackAlignment;
+  uint64_t padded = (row + alignment - 1) / alignment * alignment;
+  return padded * (height - 1) + row;
+}
+
+// Writes texture pixels: an offset when a pixel unpack buffer supplies
+// them, otherwise the client memory itself.
+static void WritePixels(const void* pixels, uint64_t bytes) {
+  uint8_t fromBuffer = gUnpackBuffer != 0;
+  WriteValue(fromBuffer);
+  if (fromBuffer) {
+    WriteValue(pixels);
+  } else {
+    WriteBlob(pixels, bytes);
+  }
+}
+
+// Components per element of glUniform*v, by opcode.
+template <GLOp Op, int Components, typename T>
+static void RecordUniformVector(GLint location, GLsizei count,
+                                const T* value) {
+  WriteOp(Op);
+  WriteValue(location);
+  WriteValue(count);
+  WriteBlob(value, uint64_t(count) * Components * sizeof(T));
+}
+
+template <GLOp Op, int Components>
+static void RecordUniformMatrix(GLint location, GLsizei count,
+                                GLboolean transpose, const GLfloat* value) {
+  WriteOp(Op);
+  WriteValue(location);
+  WriteValue(count);
+  WriteValue(transpose);
+  WriteBlob(value, uint64_t(count) * Components * sizeof(GLfloat));
+}
+
+static void InstallSpecialHooks() {
+  CAPTURE(glGenBuffers)([](GLsizei n, GLuint* names) {
+    RecordGen(GLOp::glGenBuffers, n, names);
+  });
+  CAPTURE(glGenVertexArrays)([](GLsizei n, GLuint* names) {
+    RecordGen(GLOp::glGenVertexArrays, n, names);
+  });
+  CAPTURE(glGenTextures)([](GLsizei n, GLuint* names) {
+    RecordGen(GLOp::glGenTextures, n, names);
+  });
+  CAPTURE(glGenFramebuffers)([](GLsizei n, GLuint* names) {
+    RecordGen(GLOp::glGenFramebuffers, n, names);
+  });
+  CAPTURE(glGenRenderbuffers)([](GLsizei n, GLuint* names) {
+    RecordGen(GLOp::glGenRenderbuffers, n, names);
+  });
+  CAPTURE(glGenQueries)([](GLsizei n, GLuint* names) {
+    RecordGen(GLOp::glGenQueries, n, names);
+  });
+  CAPTURE(glDeleteBuffers)([](GLsizei n, const GLuint* names) {
+    RecordGen(GLOp::glDeleteBuffers, n, names);
+  });
+  CAPTURE(glDeleteVertexArrays)([](GLsizei n, const GLuint* names) {
+    RecordGen(GLOp::glDeleteVertexArrays, n, names);
+  });
+  CAPTURE(glDeleteTextures)([](GLsizei n, const GLuint* names) {
+    RecordGen(GLOp::glDeleteTextures, n, names);
+  });
+  CAPTURE(glDeleteFramebuffers)([](GLsizei n, const GLuint* names) {
+    RecordGen(GLOp::glDeleteFramebuffers, n, names);
+  });
+  CAPTURE(glDeleteRenderbuffers)([](GLsizei n, const GLuint* names) {
+    RecordGen(GLOp::glDeleteRenderbuffers, n, names);
+  });
+  CAPTURE(glDeleteQueries)([](GLsizei n, const GLuint* names) {
+    RecordGen(GLOp::glDeleteQueries, n, names);
+  });
+
+  CAPTURE(glCreateShader)([](GLuint shader, GLenum type) {
+    WriteOp(GLOp::glCreateShader);
+    WriteValue(type);
+    WriteValue(shader);
+  });
+  CAPTURE(glCreateProgram)([](GLuint program) {
+    WriteOp(GLOp::glCreateProgram);
+    WriteValue(program);
+  });
+  CAPTURE(glShaderSource)([](GLuint shader, GLsizei count,
+                             const GLchar* const* strings,
+                             const GLint* lengths) {
+    std::string source;
+    for (GLsizei i = 0; i < count; i++) {
+      if (lengths && lengths[i] >= 0) {
+        source.append(strings[i], lengths[i]);
+      } else {
+        source.append(strings[i]);
+      }
+    }
+    WriteOp(GLOp::glShaderSource);
+    WriteValue(shader);
+    WriteBlob(source.data(), source.size());
+  });
+  CAPTURE(glGetUniformLocation)([](GLint location, GLuint program,
+                                   const GLchar* name) {
+    WriteOp(GLOp::glGetUniformLocation);
+    WriteValue(program);
+    WriteBlob(name, std::strlen(name));
+    WriteValue(location);
+  });
+  CAPTURE(glBindAttribLocation)([](GLuint program, GLuint index,
+                                   const GLchar* name) {
+    WriteOp(GLOp::glBindAttribLocation);
+    WriteValue(program);
+    WriteValue(index);
+    WriteBlob(name, std::strlen(name));
+  });
+  CAPTURE(glTransformFeedbackVaryings)([](GLuint program, GLsizei count,
+                                          const GLchar* const* varyings,
+                                          GLenum bufferMode) {
+    WriteOp(GLOp::glTransformFeedbackVaryings);
+    WriteValue(program);
+    WriteValue(count);
+    for (GLsizei i = 0; i < count; i++)
+      WriteBlob(varyings[i], std::strlen(varyings[i]));
+    WriteValue(bufferMode);
+  });
+
+  CAPTURE(glBufferData)([](GLenum target, GLsizeiptr size, const void* data,
+                           GLenum usage) {
+    WriteOp(GLOp::glBufferData);
+    WriteValue(target);
+    WriteValue(size);
+    WriteValue(usage);
+    WriteBlob(data, size);
+  });
+  CAPTURE(glBufferSubData)([](GLenum target, GLintptr offset,
+                              GLsizeiptr size, const void* data) {
+    WriteOp(GLOp::glBufferSubData);
+    WriteValue(target);
+    WriteValue(offset);
+    WriteBlob(data, size);
+  });
+
+  // Mapped writes are recorded as the mapped contents at flush or unmap.
+  CAPTURE(glMapBufferRange)([](void* memory, GLenum target, GLintptr offset,
+                               GLsizeiptr length, GLbitfield access) {
+    gMapped[target] = {static_cast<uint8_t*>(memory), offset, length, access};
+    WriteOp(GLOp::glMapBufferRange);
+    WriteValue(target);
+    WriteValue(offset);
+    WriteValue(length);
+    WriteValue(access);
+  });
+  CAPTURE(glFlushMappedBufferRange)([](GLenum target, GLintptr offset,
+                                       GLsizeiptr length) {
+    auto it = gMapped.find(target);
+    if (it == gMapped.end() || !it->second.memory) return;
+    WriteOp(GLOp::glFlushMappedBufferRange);
+    WriteValue(target);
+    WriteValue(offset);
+    WriteBlob(it->second.memory + offset, length);
+  });
+  // The mapping is gone once the driver unmaps, so its contents are
+  // copied out first.
+  CAPTURE(glUnmapBuffer)(
+      [](GLboolean, GLenum target) {
+        WriteOp(GLOp::glUnmapBuffer);
+        WriteValue(target);
+        WriteBlob(gUnmapped.data(), gUnmapped.size());
+        gUnmapped.clear();
+      },
+      [](GLenum target) {
+        auto it = gMapped.find(target);
+        if (it == gMapped.end()) return;
+        const MappedRange& range = it->second;
+        if (range.memory && (range.access & GL_MAP_WRITE_BIT) &&
+            !(range.access & GL_MAP_FLUSH_EXPLICIT_BIT)) {
+          gUnmapped.assign(range.memory, range.memory + range.length);
+        }
+        gMapped.erase(it);
+      });
+
+  CAPTURE(glPixelStorei)([](GLenum name, GLint value) {
+    if (name == GL_UNPACK_ALIGNMENT) gUnpackAlignment = value;
+    GenericRecord<GLOp::glPixelStorei, &glad_glPixelStorei>::Record(name,
+                                                                     value);
+  });
+  CAPTURE(glBindBuffer)([](GLenum target, GLuint buffer) {
+    if (target == GL_PIXEL_UNPACK_BUFFER) gUnpackBuffer = buffer;
+    GenericRecord<GLOp::glBindBuffer, &glad_glBindBuffer>::Record(target,
+                                                                  buffer);
+  });
+  CAPTURE(glTexImage2D)([](GLenum target, GLint level, GLint internalFormat,
+                           GLsizei width, GLsizei height, GLint border,
+                           GLenum format, GLenum type, const void* pixels) {
+    WriteOp(GLOp::glTexImage2D);
+    WriteValue(target);
+    WriteValue(level);
+    WriteValue(internalFormat);
+    WriteValue(width);
+    WriteValue(height);
+    WriteValue(border);
+    WriteValue(format);
+    WriteValue(type);
+    WritePixels(pixels, UploadBytes(width, height, format, type));
+  });
+  CAPTURE(glTexSubImage2D)([](GLenum target, GLint level, GLint x, GLint y,
+                              GLsizei width, GLsizei height, GLenum format,
+                              GLenum type, const void* pixels) {
+    WriteOp(GLOp::glTexSubImage2D);
+    WriteValue(target);
+    WriteValue(level);
+    WriteValue(x);
+    WriteValue(y);
+    WriteValue(width);
+    WriteValue(height);
+    WriteValue(format);
+    WriteValue(type);
+    WritePixels(pixels, UploadBytes(width, height, format, type));
+  });
+
+  CAPTURE(glUniform1fv)(RecordUniformVector<GLOp::glUniform1fv, 1, GLfloat>);
+  CAPTURE(glUniform2fv)(RecordUniformVector<GLOp::glUniform2fv, 2, GLfloat>);
+  CAPTURE(glUniform3fv)(RecordUniformVector<GLOp::glUniform3fv, 3, GLfloat>);
+  CAPTURE(glUniform4fv)(RecordUniformVector<GLOp::glUniform4fv, 4, GLfloat>);
+  CAPTURE(glUniform1iv)(RecordUniformVector<GLOp::glUniform1iv, 1, GLint>);
+  CAPTURE(glUniformMatrix3fv)(
+      RecordUniformMatrix<GLOp::glUniformMatrix3fv, 9>);
+  CAPTURE(glUniformMatrix4fv)(
+      RecordUniformMatrix<GLOp::glUniformMatrix4fv, 16>);
+
+  CAPTURE(glDrawBuffers)([](GLsizei n, const GLenum* buffers) {
+    WriteOp(GLOp::glDrawBuffers);
+    WriteValue(n);
+    Write(buffers, n * sizeof(GLenum));
+  });
+}
+
+bool StartGLCapture(const char* path) {
+  if (gOut) return false;
+  gOut = std::fopen(path, "wb");
+  if (!gOut) {
+    std::println(stderr, "Failed to open capture file {}.", path);
+    return false;
+  }
+  std::setvbuf(gOut, nullptr, _IOFBF, kWriteBuffer);
+
+  Write(kGLCaptureMagic, sizeof(kGLCaptureMagic));
+  WriteValue(kGLCaptureVersion);
+  gFrames = 0;
+
+  // Special hooks first, so they win over generic ones for the same
+  // entry point.
+  InstallSpecialHooks();
+  InstallGenericHooks();
+  return true;
+}
+
+void GLCaptureFrame() {
+  if (!gOut) return;
+  WriteOp(GLOp::kFrameEnd);
+  gFrames++;
+}
+
+void StopGLCapture() {
+  if (!gOut) return;
+  for (auto uninstall : gUninstallers) uninstall();
+  gUninstallers.clear();
+
+  std::fclose(gOut);
+  gOut = nullptr;
+  std::println("Captured {} frames, {} KiB of GL commands.", gFrames,
+               gBytes / 1024);
+}
+
+bool GLCaptureActive() { return gOut != nullptr; }
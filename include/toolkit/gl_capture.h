@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+
+// Records the GL command stream to a compact binary trace that
+// GLReplayer (see gl_replay.h) can re-execute.
+//
+// StartGLCapture() hooks the entry points listed in gl_capture_ops.h by
+// swapping glad's function pointers, and writes each call's arguments,
+// object names, buffer and texture contents, and shader sources as it
+// is made. Object names are recorded as the capturing driver returned
+// them and remapped on replay.
+//
+// Capture should start right after InitGLAD, before any objects exist.
+// The list covers every call the samples and toolkit make that changes
+// GL state or draws. Queries of state and results (glGet*,
+// glCheckFramebufferStatus), fence syncs and debug output are not
+// recorded, and neither are writes through persistently mapped buffers.
+// Calls are expected from the thread that owns the context.
+
+// Opens `path` and starts recording. Returns false if it cannot be
+// written.
+bool StartGLCapture(const char* path);
+
+// Marks the end of a frame; call once per frame, e.g. after swapping.
+void GLCaptureFrame();
+
+// Restores the original function pointers and closes the trace.
+void StopGLCapture();
+
+bool GLCaptureActive();
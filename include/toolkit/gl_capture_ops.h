@@ -0,0 +1,140 @@
+#pragma once
+#include <cstdint>
+
+// Entry points recorded by StartGLCapture and replayed by GLReplayer, as
+// an X-macro list shared by both.
+//
+// GENERIC(fn, kinds) entries take only scalar arguments, recorded as raw
+// values. `kinds` has one letter per argument saying which object
+// namespace it names, so replay can map captured names to its own:
+//   v  plain value          b  buffer         a  vertex array
+//   t  texture              p  program        s  shader
+//   f  framebuffer          r  renderbuffer   u  uniform location
+//   q  query
+// Pointer arguments marked v are offsets into a bound buffer.
+//
+// SPECIAL(fn) entries create or delete objects, or pass client memory,
+// and have hand-written capture and replay.
+#define GL_CAPTURE_OPS(GENERIC, SPECIAL)                  \
+  SPECIAL(glGenBuffers)                                   \
+  SPECIAL(glGenVertexArrays)                              \
+  SPECIAL(glGenTextures)                                  \
+  SPECIAL(glGenFramebuffers)                              \
+  SPECIAL(glGenRenderbuffers)                             \
+  SPECIAL(glGenQueries)                                   \
+  SPECIAL(glDeleteBuffers)                                \
+  SPECIAL(glDeleteVertexArrays)                           \
+  SPECIAL(glDeleteTextures)                               \
+  SPECIAL(glDeleteFramebuffers)                           \
+  SPECIAL(glDeleteRenderbuffers)                          \
+  SPECIAL(glDeleteQueries)                                \
+  SPECIAL(glCreateShader)                                 \
+  SPECIAL(glCreateProgram)                                \
+  SPECIAL(glShaderSource)                                 \
+  SPECIAL(glGetUniformLocation)                           \
+  SPECIAL(glBindAttribLocation)                           \
+  SPECIAL(glTransformFeedbackVaryings)                    \
+  SPECIAL(glBufferData)                                   \
+  SPECIAL(glBufferSubData)                                \
+  SPECIAL(glMapBufferRange)                               \
+  SPECIAL(glFlushMappedBufferRange)                       \
+  SPECIAL(glUnmapBuffer)                                  \
+  SPECIAL(glTexImage2D)                                   \
+  SPECIAL(glTexSubImage2D)                                \
+  SPECIAL(glUniform1fv)                                   \
+  SPECIAL(glUniform2fv)                                   \
+  SPECIAL(glUniform3fv)                                   \
+  SPECIAL(glUniform4fv)                                   \
+  SPECIAL(glUniform1iv)                                   \
+  SPECIAL(glUniformMatrix3fv)                             \
+  SPECIAL(glUniformMatrix4fv)                             \
+  SPECIAL(glDrawBuffers)                                  \
+  GENERIC(glDeleteShader, "s")                            \
+  GENERIC(glDeleteProgram, "p")                           \
+  GENERIC(glCompileShader, "s")                           \
+  GENERIC(glAttachShader, "ps")                           \
+  GENERIC(glDetachShader, "ps")                           \
+  GENERIC(glLinkProgram, "p")                             \
+  GENERIC(glUniformBlockBinding, "pvv")                   \
+  GENERIC(glUseProgram, "p")                              \
+  GENERIC(glUniform1i, "uv")                              \
+  GENERIC(glUniform1f, "uv")                              \
+  GENERIC(glUniform2f, "uvv")                             \
+  GENERIC(glUniform3f, "uvvv")                            \
+  GENERIC(glUniform4f, "uvvvv")                           \
+  GENERIC(glBindBuffer, "vb")                             \
+  GENERIC(glBindBufferBase, "vvb")                        \
+  GENERIC(glBindBufferRange, "vvbvv")                     \
+  GENERIC(glBindVertexArray, "a")                         \
+  GENERIC(glBindTexture, "vt")                            \
+  GENERIC(glActiveTexture, "v")                           \
+  GENERIC(glBindFramebuffer, "vf")                        \
+  GENERIC(glBindRenderbuffer, "vr")                       \
+  GENERIC(glTexParameteri, "vvv")                         \
+  GENERIC(glTexParameterf, "vvv")                         \
+  GENERIC(glGenerateMipmap, "v")                          \
+  GENERIC(glPixelStorei, "vv")                            \
+  GENERIC(glTexImage2DMultisample, "vvvvvv")              \
+  GENERIC(glTexBuffer, "vvb")                             \
+  GENERIC(glVertexAttribPointer, "vvvvvv")                \
+  GENERIC(glVertexAttribIPointer, "vvvvv")                \
+  GENERIC(glEnableVertexAttribArray, "v")                 \
+  GENERIC(glDisableVertexAttribArray, "v")                \
+  GENERIC(glVertexAttribDivisor, "vv")                    \
+  GENERIC(glVertexAttrib4f, "vvvvv")                      \
+  GENERIC(glFramebufferTexture2D, "vvvtv")                \
+  GENERIC(glFramebufferRenderbuffer, "vvvr")              \
+  GENERIC(glRenderbufferStorage, "vvvv")                  \
+  GENERIC(glRenderbufferStorageMultisample, "vvvvv")      \
+  GENERIC(glBlitFramebuffer, "vvvvvvvvvv")                \
+  GENERIC(glReadBuffer, "v")                              \
+  GENERIC(glDrawBuffer, "v")                              \
+  GENERIC(glEnable, "v")                                  \
+  GENERIC(glDisable, "v")                                 \
+  GENERIC(glBlendFunc, "vv")                              \
+  GENERIC(glBlendFuncSeparate, "vvvv")                    \
+  GENERIC(glBlendEquation, "v")                           \
+  GENERIC(glDepthFunc, "v")                               \
+  GENERIC(glDepthMask, "v")                               \
+  GENERIC(glColorMask, "vvvv")                            \
+  GENERIC(glCullFace, "v")                                \
+  GENERIC(glFrontFace, "v")                               \
+  GENERIC(glPolygonMode, "vv")                            \
+  GENERIC(glLineWidth, "v")                               \
+  GENERIC(glViewport, "vvvv")                             \
+  GENERIC(glScissor, "vvvv")                              \
+  GENERIC(glClearColor, "vvvv")                           \
+  GENERIC(glClearDepth, "v")                              \
+  GENERIC(glClear, "v")                                   \
+  GENERIC(glDrawArrays, "vvv")                            \
+  GENERIC(glDrawElements, "vvvv")                         \
+  GENERIC(glDrawArraysInstanced, "vvvv")                  \
+  GENERIC(glDrawElementsInstanced, "vvvvv")               \
+  GENERIC(glDrawElementsBaseVertex, "vvvvv")              \
+  GENERIC(glDrawElementsInstancedBaseVertex, "vvvvvv")    \
+  GENERIC(glDrawElementsInstancedBaseVertexBaseInstance,  \
+          "vvvvvvv")                                      \
+  GENERIC(glMultiDrawElementsIndirect, "vvvvv")           \
+  GENERIC(glDrawRangeElements, "vvvvvv")                  \
+  GENERIC(glBeginTransformFeedback, "v")                  \
+  GENERIC(glEndTransformFeedback, "")                     \
+  GENERIC(glBeginQuery, "vq")                             \
+  GENERIC(glEndQuery, "v")                                \
+  GENERIC(glQueryCounter, "qv")                           \
+  GENERIC(glFlush, "")                                    \
+  GENERIC(glFinish, "")
+
+// Record opcodes: one per entry point, plus the frame marker.
+enum class GLOp : uint16_t {
+  kFrameEnd = 0,
+#define GL_CAPTURE_ENUM_GENERIC(fn, kinds) fn,
+#define GL_CAPTURE_ENUM_SPECIAL(fn) fn,
+  GL_CAPTURE_OPS(GL_CAPTURE_ENUM_GENERIC, GL_CAPTURE_ENUM_SPECIAL)
+#undef GL_CAPTURE_ENUM_GENERIC
+#undef GL_CAPTURE_ENUM_SPECIAL
+      kCount
+};
+
+// File header: magic, then a little-endian uint32 version.
+constexpr char kGLCaptureMagic[8] = {'G', 'L', 'C', 'A', 'P', 'T', 'R', 'C'};
+constexpr uint32_t kGLCaptureVersion = 2;
@@ -0,0 +1,95 @@
+#include <glad/glad.h>
+
+#include "gl_format.h"
+
+uint64_t GLTexelBytes(unsigned int format, unsigned int type) {
+  uint64_t components;
+  switch (format) {
+    case GL_RED:
+    case GL_RED_INTEGER:
+    case GL_DEPTH_COMPONENT:
+    case GL_STENCIL_INDEX:
+      components = 1;
+      break;
+    case GL_RG:
+    case GL_RG_INTEGER:
+    case GL_DEPTH_STENCIL:
+      components = 2;
+      break;
+    case GL_RGB:
+    case GL_BGR:
+    case GL_RGB_INTEGER:
+      components = 3;
+      break;
+    default:
+      components = 4;
+      break;
+  }
+
+  uint64_t texel;
+  switch (type) {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+      texel = components;
+      break;
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:
+      texel = components * 2;
+      break;
+    case GL_UNSIGNED_INT:
+    case GL_INT:
+    case GL_FLOAT:
+      texel = components * 4;
+      break;
+    // Packed types hold a whole texel in one value.
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+      texel = 2;
+      break;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      texel = 8;
+      break;
+    default:
+      texel = 4;
+      break;
+  }
+  return texel;
+}
+
+uint64_t GLInternalFormatBytes(unsigned int internalFormat) {
+  switch (internalFormat) {
+    case GL_R8:
+      return 1;
+    case GL_RG8:
+    case GL_R16F:
+    case GL_DEPTH_COMPONENT16:
+      return 2;
+    case GL_RGB8:
+    case GL_SRGB8:
+    case GL_DEPTH_COMPONENT24:
+      return 3;
+    case GL_RG16F:
+    case GL_R32F:
+    case GL_DEPTH_COMPONENT32F:
+    case GL_DEPTH24_STENCIL8:
+    case GL_R11F_G11F_B10F:
+    case GL_RGB10_A2:
+    case GL_RGBA8:
+    case GL_SRGB8_ALPHA8:
+      return 4;
+    case GL_RGB16F:
+      return 6;
+    case GL_RGBA16F:
+    case GL_RG32F:
+    case GL_DEPTH32F_STENCIL8:
+      return 8;
+    case GL_RGB32F:
+      return 12;
+    case GL_RGBA32F:
+      return 16;
+    default:
+      return 4;
+  }
+}
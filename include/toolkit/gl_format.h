@@ -0,0 +1,11 @@
+#pragma once
+#include <cstdint>
+
+// Bytes one texel of client pixel data takes in `format` and `type`, as
+// passed to glTexImage2D and friends.
+uint64_t GLTexelBytes(unsigned int format, unsigned int type);
+
+// Bytes the driver needs per texel for a sized internal format, as
+// passed to glTexImage2D or glRenderbufferStorage. Unknown formats count
+// as 4.
+uint64_t GLInternalFormatBytes(unsigned int internalFormat);
@@ -0,0 +1,302 @@
+#include <glad/glad.h>
+
+#include "gl_intercept.h"
+
+#include "gl_format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <print>
+#include <type_traits>
+
+static GLFrameStats gLastFrame;
+
+#ifdef TOOLKIT_GL_INTERCEPT
+
+namespace {
+
+enum class Category { kDraw, kBind, kUpload, kMap, kShader, kOther };
+
+// Running totals for one hooked entry point. Atomic so calls from a
+// second context's thread are still counted correctly.
+struct Entry {
+  const char* name;
+  Category category;
+  std::atomic<uint64_t> calls = 0;
+  std::atomic<uint64_t> bytes = 0;
+  std::atomic<uint64_t> nanoseconds = 0;
+};
+
+}  // namespace
+
+// Plenty for the hooked set below; Install() refuses more.
+constexpr size_t kMaxEntries = 96;
+static Entry gEntries[kMaxEntries];
+static size_t gEntryCount = 0;
+
+// Restores one hooked pointer each.
+static std::vector<void (*)()> gUninstallers;
+
+static int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Wrapper for the glad function pointer `Slot`. In lazy mode the original
+// pointer may be a glad trampoline that overwrites `Slot` with the driver
+// entry on first call; the wrapper then adopts that entry and restores
+// the slot.
+template <auto* Slot, typename Fn = std::remove_pointer_t<decltype(Slot)>>
+struct Hook;
+
+template <auto* Slot, typename R, typename... A>
+struct Hook<Slot, R(APIENTRYP)(A...)> {
+  using Fn = R(APIENTRYP)(A...);
+
+  // Atomic, like the slot itself, because glad's lazy stubs and the
+  // healing below run on whichever thread first makes the call.
+  static inline std::atomic<Fn> original = nullptr;
+  static inline Entry* entry = nullptr;
+  // Bytes a call moves, for upload entry points.
+  static inline uint64_t (*bytes)(A...) = nullptr;
+
+  static R APIENTRY Call(A... args) {
+    entry->calls.fetch_add(1, std::memory_order_relaxed);
+    if (bytes) {
+      entry->bytes.fetch_add(bytes(args...), std::memory_order_relaxed);
+    }
+
+    Fn hooked = SlotRef().load(std::memory_order_acquire);
+    Fn call = original.load(std::memory_order_acquire);
+    int64_t start = NowNs();
+    if constexpr (std::is_void_v<R>) {
+      call(args...);
+      Finish(start, hooked);
+    } else {
+      R result = call(args...);
+      Finish(start, hooked);
+      return result;
+    }
+  }
+
+  static std::atomic_ref<Fn> SlotRef() { return std::atomic_ref<Fn>(*Slot); }
+
+  // Only a change made while the original ran is a glad trampoline
+  // resolving itself; other hooks installed on top stay in place.
+  static void Finish(int64_t start, Fn hooked) {
+    entry->nanoseconds.fetch_add(NowNs() - start, std::memory_order_relaxed);
+    Fn resolved = SlotRef().load(std::memory_order_acquire);
+    if (resolved != hooked) {
+      original.store(resolved, std::memory_order_release);
+      SlotRef().store(hooked, std::memory_order_release);
+    }
+  }
+
+  static void Install(const char* name, Category category) {
+    if (!*Slot || *Slot == Call) return;
+    // The entry outlives uninstalling, so installing again after a
+    // context is recreated keeps counting into the same one.
+    if (!entry) {
+      if (gEntryCount == kMaxEntries) return;
+      entry = &gEntries[gEntryCount++];
+      entry->name = name;
+      entry->category = category;
+    }
+    original.store(*Slot, std::memory_order_release);
+    SlotRef().store(Call, std::memory_order_release);
+    gUninstallers.push_back([] {
+      Fn expected = Call;
+      SlotRef().compare_exchange_strong(expected, original.load());
+    });
+  }
+};
+
+#define HOOK(fn, category) Hook<&glad_##fn>::Install(#fn, Category::category)
+#define HOOK_BYTES(fn) Hook<&glad_##fn>::bytes
+
+// Bytes in `width` * `height` * `depth` texels of `format` and `type`.
+static uint64_t PixelBytes(GLenum format, GLenum type, GLsizei width,
+                           GLsizei height, GLsizei depth) {
+  return GLTexelBytes(format, type) * width * height * depth;
+}
+
+static void InstallHooks() {
+  HOOK(glDrawArrays, kDraw);
+  HOOK(glDrawElements, kDraw);
+  HOOK(glDrawArraysInstanced, kDraw);
+  HOOK(glDrawElementsInstanced, kDraw);
+  HOOK(glDrawRangeElements, kDraw);
+  HOOK(glDrawElementsBaseVertex, kDraw);
+  HOOK(glDrawElementsInstancedBaseVertex, kDraw);
+  HOOK(glMultiDrawArrays, kDraw);
+  HOOK(glMultiDrawElements, kDraw);
+  HOOK(glDrawArraysIndirect, kDraw);
+  HOOK(glDrawElementsIndirect, kDraw);
+  HOOK(glMultiDrawArraysIndirect, kDraw);
+  HOOK(glMultiDrawElementsIndirect, kDraw);
+  HOOK(glDrawArraysInstancedBaseInstance, kDraw);
+  HOOK(glDrawElementsInstancedBaseInstance, kDraw);
+  HOOK(glDrawElementsInstancedBaseVertexBaseInstance, kDraw);
+
+  HOOK(glBindBuffer, kBind);
+  HOOK(glBindBufferBase, kBind);
+  HOOK(glBindBufferRange, kBind);
+  HOOK(glBindVertexArray, kBind);
+  HOOK(glBindTexture, kBind);
+  HOOK(glActiveTexture, kBind);
+  HOOK(glUseProgram, kBind);
+  HOOK(glBindFramebuffer, kBind);
+  HOOK(glBindRenderbuffer, kBind);
+  HOOK(glBindSampler, kBind);
+
+  HOOK(glBufferData, kUpload);
+  HOOK_BYTES(glBufferData) = [](GLenum, GLsizeiptr size, const void*,
+                                GLenum) -> uint64_t { return size; };
+  HOOK(glBufferSubData, kUpload);
+  HOOK_BYTES(glBufferSubData) = [](GLenum, GLintptr, GLsizeiptr size,
+                                   const void*) -> uint64_t { return size; };
+  HOOK(glBufferStorage, kUpload);
+  HOOK_BYTES(glBufferStorage) = [](GLenum, GLsizeiptr size, const void*,
+                                   GLbitfield) -> uint64_t { return size; };
+  // Mapped ranges are counted apart from uploads: how much of a range is
+  // written is not visible here.
+  HOOK(glMapBufferRange, kMap);
+  HOOK_BYTES(glMapBufferRange) = [](GLenum, GLintptr, GLsizeiptr length,
+                                    GLbitfield) -> uint64_t { return length; };
+  HOOK(glFlushMappedBufferRange, kMap);
+  HOOK(glUnmapBuffer, kMap);
+  HOOK(glTexImage2D, kUpload);
+  HOOK_BYTES(glTexImage2D) = [](GLenum, GLint, GLint, GLsizei width,
+                                GLsizei height, GLint, GLenum format,
+                                GLenum type, const void* pixels) -> uint64_t {
+    return pixels ? PixelBytes(format, type, width, height, 1) : 0;
+  };
+  HOOK(glTexSubImage2D, kUpload);
+  HOOK_BYTES(glTexSubImage2D) = [](GLenum, GLint, GLint, GLint,
+                                   GLsizei width, GLsizei height,
+                                   GLenum format, GLenum type,
+                                   const void*) -> uint64_t {
+    return PixelBytes(format, type, width, height, 1);
+  };
+  HOOK(glTexImage3D, kUpload);
+  HOOK_BYTES(glTexImage3D) =
+      [](GLenum, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth,
+         GLint, GLenum format, GLenum type, const void* pixels) -> uint64_t {
+    return pixels ? PixelBytes(format, type, width, height, depth) : 0;
+  };
+  HOOK(glTexSubImage3D, kUpload);
+  HOOK_BYTES(glTexSubImage3D) =
+      [](GLenum, GLint, GLint, GLint, GLint, GLsizei width, GLsizei height,
+         GLsizei depth, GLenum format, GLenum type, const void*) -> uint64_t {
+    return PixelBytes(format, type, width, height, depth);
+  };
+
+  HOOK(glShaderSource, kShader);
+  HOOK(glCompileShader, kShader);
+  HOOK(glLinkProgram, kShader);
+  HOOK(glProgramBinary, kShader);
+
+  HOOK(glClear, kOther);
+  HOOK(glViewport, kOther);
+  HOOK(glEnable, kOther);
+  HOOK(glDisable, kOther);
+  HOOK(glVertexAttribPointer, kOther);
+  HOOK(glGetUniformLocation, kOther);
+  HOOK(glUniform1i, kOther);
+  HOOK(glUniform4f, kOther);
+  HOOK(glUniformMatrix4fv, kOther);
+  HOOK(glBlitFramebuffer, kOther);
+  HOOK(glReadPixels, kOther);
+  HOOK(glGetError, kOther);
+  HOOK(glFlush, kOther);
+  HOOK(glFinish, kOther);
+}
+
+bool InstallGLIntercept() {
+  InstallHooks();
+  return true;
+}
+
+void UninstallGLIntercept() {
+  for (auto uninstall : gUninstallers) uninstall();
+  gUninstallers.clear();
+}
+
+void EndGLInterceptFrame() {
+  GLFrameStats frame;
+  uint64_t nanoseconds = 0;
+  for (size_t i = 0; i < gEntryCount; i++) {
+    Entry& entry = gEntries[i];
+    GLCallStats stats = {entry.name,
+                         entry.calls.exchange(0, std::memory_order_relaxed),
+                         entry.bytes.exchange(0, std::memory_order_relaxed),
+                         entry.nanoseconds.exchange(0,
+                                                    std::memory_order_relaxed)};
+    if (stats.calls == 0) continue;
+
+    frame.calls += stats.calls;
+    nanoseconds += stats.nanoseconds;
+    switch (entry.category) {
+      case Category::kDraw:
+        frame.draws += stats.calls;
+        break;
+      case Category::kBind:
+        frame.binds += stats.calls;
+        break;
+      case Category::kUpload:
+        frame.uploads += stats.calls;
+        frame.uploadBytes += stats.bytes;
+        break;
+      case Category::kMap:
+        frame.maps += stats.calls;
+        frame.mappedBytes += stats.bytes;
+        break;
+      case Category::kShader:
+        frame.shaderBuilds += stats.calls;
+        break;
+      case Category::kOther:
+        break;
+    }
+    frame.entries.push_back(stats);
+  }
+
+  frame.milliseconds = nanoseconds / 1e6;
+  std::ranges::sort(frame.entries, [](const auto& a, const auto& b) {
+    return a.nanoseconds > b.nanoseconds;
+  });
+  gLastFrame = std::move(frame);
+}
+
+#else
+
+bool InstallGLIntercept() {
+  std::println(stderr, "GL interception is compiled out; configure with "
+                       "-DTOOLKIT_GL_INTERCEPT=ON.");
+  return false;
+}
+
+void UninstallGLIntercept() {}
+void EndGLInterceptFrame() {}
+
+#endif
+
+const GLFrameStats& LastGLFrameStats() { return gLastFrame; }
+
+void PrintGLFrameStats(FILE* out, int top) {
+  const GLFrameStats& frame = gLastFrame;
+  std::println(out,
+               "GL: {} calls in {:.3f} ms, {} draws, {} binds, {} uploads "
+               "({} KiB), {} map calls ({} KiB mapped), {} shader calls",
+               frame.calls, frame.milliseconds, frame.draws, frame.binds,
+               frame.uploads, frame.uploadBytes / 1024, frame.maps,
+               frame.mappedBytes / 1024, frame.shaderBuilds);
+
+  int shown = std::min<int>(top, frame.entries.size());
+  for (int i = 0; i < shown; i++) {
+    const GLCallStats& entry = frame.entries[i];
+    std::println(out, "  {:<32} {:>6} calls {:>9.3f} ms", entry.name,
+                 entry.calls, entry.nanoseconds / 1e6);
+  }
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Per-frame statistics for GL calls, gathered by swapping glad's function
+// pointers for counting wrappers.
+//
+// InstallGLIntercept() replaces the pointers of the entry points that
+// matter for frame cost (draws, binds, uploads, shader builds and common
+// state) with wrappers that count calls, bytes handed to the driver and
+// wall time, then forward to the driver. Entry points that are not
+// hooked, and everything when interception is not installed, are called
+// directly as before. Configuring with -DTOOLKIT_GL_INTERCEPT=OFF leaves
+// the wrappers out of the build entirely.
+
+// One entry point's totals over a frame.
+struct GLCallStats {
+  const char* name;
+  uint64_t calls;
+  // Bytes uploaded, for buffer and texture uploads, or mapped, for
+  // glMapBufferRange.
+  uint64_t bytes;
+  uint64_t nanoseconds;
+};
+
+// A frame's totals across all hooked entry points.
+struct GLFrameStats {
+  uint64_t calls = 0;
+  uint64_t draws = 0;
+  uint64_t binds = 0;
+  uint64_t uploads = 0;
+  uint64_t uploadBytes = 0;
+  // Map, flush and unmap calls, and the bytes of the ranges mapped. Not
+  // part of uploadBytes, since a mapped range may be written only in
+  // part or not at all.
+  uint64_t maps = 0;
+  uint64_t mappedBytes = 0;
+  uint64_t shaderBuilds = 0;
+  // Time spent inside hooked calls, which includes driver work done
+  // synchronously but not GPU execution.
+  double milliseconds = 0;
+  // Entry points called in the frame, most time first.
+  std::vector<GLCallStats> entries;
+};
+
+// Hooks the GL entry points. Call after InitGLAD with the context
+// current. Returns false if interception is compiled out.
+bool InstallGLIntercept();
+
+// Restores the original function pointers.
+void UninstallGLIntercept();
+
+// Closes the current frame's counters; call once per frame, e.g. after
+// swapping buffers.
+void EndGLInterceptFrame();
+
+// Totals of the last frame closed by EndGLInterceptFrame().
+const GLFrameStats& LastGLFrameStats();
+
+// Prints the last frame's totals and its `top` most expensive entry
+// points.
+void PrintGLFrameStats(FILE* out = stdout, int top = 8);
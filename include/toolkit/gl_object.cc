@@ -0,0 +1,165 @@
+#include <glad/glad.h>
+
+#include "gl_object.h"
+
+#include "deferred_release.h"
+
+#include <print>
+
+static const char* TypeName(GLObjectType type) {
+  switch (type) {
+    case GLObjectType::kBuffer:
+      return "buffer";
+    case GLObjectType::kVertexArray:
+      return "vertex array";
+    case GLObjectType::kTexture:
+      return "texture";
+    default:
+      return "object";
+  }
+}
+
+static void GenNames(GLObjectType type, int count, unsigned int* names) {
+  switch (type) {
+    case GLObjectType::kBuffer:
+      glGenBuffers(count, names);
+      break;
+    case GLObjectType::kVertexArray:
+      glGenVertexArrays(count, names);
+      break;
+    case GLObjectType::kTexture:
+      glGenTextures(count, names);
+      break;
+    default:
+      break;
+  }
+}
+
+static void DeleteNames(GLObjectType type, int count,
+                        const unsigned int* names) {
+  switch (type) {
+    case GLObjectType::kBuffer:
+      glDeleteBuffers(count, names);
+      break;
+    case GLObjectType::kVertexArray:
+      glDeleteVertexArrays(count, names);
+      break;
+    case GLObjectType::kTexture:
+      glDeleteTextures(count, names);
+      break;
+    default:
+      break;
+  }
+}
+
+std::pair<uint32_t, uint32_t> GLObjectTable::Allocate(GLObjectType type,
+                                                      unsigned int name) {
+  std::vector<unsigned int>& spare = spare_[static_cast<size_t>(type)];
+  if (name == 0) {
+    if (spare.empty()) {
+      spare.resize(blockSize_);
+      GenNames(type, blockSize_, spare.data());
+    }
+    name = spare.back();
+    spare.pop_back();
+  }
+
+  uint32_t index;
+  if (freeSlots_.empty()) {
+    index = slots_.size();
+    slots_.emplace_back();
+  } else {
+    index = freeSlots_.back();
+    freeSlots_.pop_back();
+  }
+
+  Slot& slot = slots_[index];
+  slot.name = name;
+  slot.type = type;
+  return {index, slot.generation};
+}
+
+BufferHandle GLObjectTable::AcquireBuffer(size_t bytes, unsigned int usage) {
+  if (releaseQueue_ == nullptr) return {};
+  unsigned int name = releaseQueue_->AcquireBuffer(bytes, usage);
+  if (name == 0) return {};
+
+  auto [index, generation] = Allocate(GLObjectType::kBuffer, name);
+  slots_[index].bytes = bytes;
+  return {index, generation};
+}
+
+unsigned int GLObjectTable::Lookup(GLObjectType type, uint32_t index,
+                                   uint32_t generation) const {
+  if (index < slots_.size() && slots_[index].generation == generation &&
+      slots_[index].type == type)
+    return slots_[index].name;
+
+  std::println(stderr, "Use of destroyed {} handle {}:{}", TypeName(type),
+               index, generation);
+  return 0;
+}
+
+void GLObjectTable::Resize(GLObjectType type, uint32_t index,
+                           uint32_t generation, size_t bytes) {
+  if (Lookup(type, index, generation) != 0) slots_[index].bytes = bytes;
+}
+
+void GLObjectTable::Free(GLObjectType type, uint32_t index,
+                         uint32_t generation, unsigned int usage) {
+  // Release() already deleted the object.
+  if (released_) return;
+  if (Lookup(type, index, generation) == 0) return;
+
+  Slot& slot = slots_[index];
+  doomed_[static_cast<size_t>(type)].push_back(slot.name);
+  doomedBytes_[static_cast<size_t>(type)].push_back(slot.bytes);
+  doomedUsage_[static_cast<size_t>(type)].push_back(usage);
+  slot.name = 0;
+  slot.bytes = 0;
+  slot.type = GLObjectType::kCount;
+  // Skip 0 on wrap-around so null handles never match a slot.
+  if (++slot.generation == 0) slot.generation = 1;
+  freeSlots_.push_back(index);
+}
+
+void GLObjectTable::Flush() {
+  for (size_t t = 0; t < kTypes; t++) {
+    std::vector<unsigned int>& doomed = doomed_[t];
+    if (doomed.empty()) continue;
+
+    GLObjectType type = static_cast<GLObjectType>(t);
+    if (releaseQueue_ != nullptr) {
+      for (size_t i = 0; i < doomed.size(); i++) {
+        if (doomedUsage_[t][i] != 0) {
+          releaseQueue_->RecycleBuffer(doomed[i], doomedBytes_[t][i],
+                                       doomedUsage_[t][i]);
+        } else {
+          releaseQueue_->Delete(type, doomed[i], doomedBytes_[t][i]);
+        }
+      }
+    } else {
+      DeleteNames(type, doomed.size(), doomed.data());
+    }
+    doomed.clear();
+    doomedBytes_[t].clear();
+    doomedUsage_[t].clear();
+  }
+}
+
+void GLObjectTable::Release() {
+  for (Slot& slot : slots_)
+    if (slot.type != GLObjectType::kCount)
+      doomed_[static_cast<size_t>(slot.type)].push_back(slot.name);
+  for (size_t t = 0; t < kTypes; t++) {
+    doomed_[t].insert(doomed_[t].end(), spare_[t].begin(), spare_[t].end());
+    spare_[t].clear();
+  }
+  // Tearing down, so there is no later frame to wait for.
+  releaseQueue_ = nullptr;
+  Flush();
+
+  slots_.clear();
+  freeSlots_.clear();
+  released_ = true;
+}
@@ -0,0 +1,168 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class DeferredReleaseQueue;
+
+// Kinds of GL object managed by a GLObjectTable.
+enum class GLObjectType : uint8_t { kBuffer, kVertexArray, kTexture, kCount };
+
+// Weak, copyable reference to a GL object in a GLObjectTable. Resolving a
+// handle whose object has been destroyed yields 0 instead of a GL name
+// that may since have been handed to something else.
+template <GLObjectType T>
+struct GLHandle {
+  uint32_t index = 0;
+  // 0 is never a live generation, so a default handle is always null.
+  uint32_t generation = 0;
+
+  explicit operator bool() const { return generation != 0; }
+  bool operator==(const GLHandle&) const = default;
+};
+
+using BufferHandle = GLHandle<GLObjectType::kBuffer>;
+using VertexArrayHandle = GLHandle<GLObjectType::kVertexArray>;
+using TextureHandle = GLHandle<GLObjectType::kTexture>;
+
+// Owns GL object names behind generational handles.
+//
+// Names are generated in blocks with a single glGen* call per block, and
+// destroyed objects are queued and deleted with one glDelete* call per
+// type in Flush(), which callers run once per frame. The table itself
+// never touches GL outside Create(), Flush() and Release().
+class GLObjectTable {
+ public:
+  explicit GLObjectTable(int blockSize = 64) : blockSize_(blockSize) {}
+
+  GLObjectTable(const GLObjectTable&) = delete;
+  GLObjectTable& operator=(const GLObjectTable&) = delete;
+
+  template <GLObjectType T>
+  GLHandle<T> Create() {
+    auto [index, generation] = Allocate(T, 0);
+    return {index, generation};
+  }
+
+  // Returns a buffer recycled through the release queue that already
+  // holds `bytes` bytes of storage created with `usage`, or a null handle
+  // if there is none. Its contents can be replaced with glBufferSubData
+  // without waiting on the GPU.
+  BufferHandle AcquireBuffer(size_t bytes, unsigned int usage);
+
+  // Returns the GL name, or 0 and a warning if `handle` is stale.
+  template <GLObjectType T>
+  unsigned int Get(GLHandle<T> handle) const {
+    return Lookup(T, handle.index, handle.generation);
+  }
+
+  // Records how much memory the object behind `handle` holds, e.g. a
+  // buffer's size. Only reported to the release queue.
+  template <GLObjectType T>
+  void SetBytes(GLHandle<T> handle, size_t bytes) {
+    Resize(T, handle.index, handle.generation, bytes);
+  }
+
+  // Invalidates `handle` and queues its name for deletion. Destroying a
+  // stale handle is reported and ignored; after Release() every handle
+  // is dropped quietly.
+  template <GLObjectType T>
+  void Destroy(GLHandle<T> handle) {
+    Free(T, handle.index, handle.generation, 0);
+  }
+
+  // Like Destroy(), but with a release queue the buffer's storage is kept
+  // for AcquireBuffer() instead of deleted. `usage` is the one its
+  // storage was created with; its size is the one given to SetBytes().
+  void Recycle(BufferHandle handle, unsigned int usage) {
+    Free(GLObjectType::kBuffer, handle.index, handle.generation, usage);
+  }
+
+  // Deletes every queued name. Call once per frame.
+  void Flush();
+
+  // Hands destroyed names to `queue` in Flush() instead of deleting them
+  // right away, so objects the GPU is still reading are left alone until
+  // it is done. Pass null to delete directly again.
+  void SetReleaseQueue(DeferredReleaseQueue* queue) { releaseQueue_ = queue; }
+
+  // Deletes live, queued and pre-generated names. Must be called while
+  // the context is still current. Handles still held afterwards, e.g. by
+  // GLObjects, can be destroyed without effect.
+  void Release();
+
+  // Number of live objects of every type.
+  size_t Live() const { return slots_.size() - freeSlots_.size(); }
+
+ private:
+  struct Slot {
+    unsigned int name = 0;
+    uint32_t generation = 1;
+    GLObjectType type = GLObjectType::kCount;
+    size_t bytes = 0;
+  };
+
+  static constexpr size_t kTypes = static_cast<size_t>(GLObjectType::kCount);
+
+  // Takes a slot for `name`, or for a pre-generated name if it is 0.
+  std::pair<uint32_t, uint32_t> Allocate(GLObjectType type,
+                                         unsigned int name);
+  unsigned int Lookup(GLObjectType type, uint32_t index,
+                      uint32_t generation) const;
+  void Resize(GLObjectType type, uint32_t index, uint32_t generation,
+              size_t bytes);
+  void Free(GLObjectType type, uint32_t index, uint32_t generation,
+            unsigned int usage);
+
+  int blockSize_;
+  bool released_ = false;
+  DeferredReleaseQueue* releaseQueue_ = nullptr;
+  std::vector<Slot> slots_;
+  std::vector<uint32_t> freeSlots_;
+  std::array<std::vector<unsigned int>, kTypes> spare_;
+  std::array<std::vector<unsigned int>, kTypes> doomed_;
+  // Size of each doomed name, and for buffers to recycle their usage (0
+  // to delete), in the same order.
+  std::array<std::vector<size_t>, kTypes> doomedBytes_;
+  std::array<std::vector<unsigned int>, kTypes> doomedUsage_;
+};
+
+// Owning handle that destroys its object when it goes out of scope. The
+// GL name is only deleted on the table's next Flush(), so this is safe
+// to drop after the context is gone as long as the table outlives it.
+template <GLObjectType T>
+class GLObject {
+ public:
+  GLObject() = default;
+  explicit GLObject(GLObjectTable& table)
+      : table_(&table), handle_(table.Create<T>()) {}
+  ~GLObject() { Reset(); }
+
+  GLObject(GLObject&& other) noexcept
+      : table_(other.table_), handle_(std::exchange(other.handle_, {})) {}
+  GLObject& operator=(GLObject&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      table_ = other.table_;
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  unsigned int Name() const { return handle_ ? table_->Get(handle_) : 0; }
+  GLHandle<T> Handle() const { return handle_; }
+
+  void Reset() {
+    if (handle_) table_->Destroy(std::exchange(handle_, {}));
+  }
+
+ private:
+  GLObjectTable* table_ = nullptr;
+  GLHandle<T> handle_;
+};
+
+using Buffer = GLObject<GLObjectType::kBuffer>;
+using VertexArray = GLObject<GLObjectType::kVertexArray>;
+using Texture = GLObject<GLObjectType::kTexture>;
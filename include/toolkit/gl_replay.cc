@@ -0,0 +1,437 @@
+#include <glad/glad.h>
+
+#include "gl_replay.h"
+
+#include <cstdio>
+#include <cstring>
+#include <print>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gl_capture_ops.h"
+
+bool GLReplayer::Open(const char* path) {
+  FILE* in = std::fopen(path, "rb");
+  if (!in) {
+    std::println(stderr, "Failed to open trace {}.", path);
+    return false;
+  }
+  std::fseek(in, 0, SEEK_END);
+  long size = std::ftell(in);
+  std::fseek(in, 0, SEEK_SET);
+  data_.resize(size > 0 ? size : 0);
+  size_t read = std::fread(data_.data(), 1, data_.size(), in);
+  std::fclose(in);
+
+  cursor_ = 0;
+  frames_ = 0;
+  failed_ = read != data_.size();
+
+  char magic[sizeof(kGLCaptureMagic)] = {};
+  if (data_.size() >= sizeof(magic)) {
+    std::memcpy(magic, data_.data(), sizeof(magic));
+    cursor_ = sizeof(magic);
+  } else {
+    failed_ = true;
+  }
+  uint32_t version = Read<uint32_t>();
+  if (failed_ || std::memcmp(magic, kGLCaptureMagic, sizeof(magic)) != 0 ||
+      version != kGLCaptureVersion) {
+    std::println(stderr, "{} is not a version {} GL capture.", path,
+                 kGLCaptureVersion);
+    return false;
+  }
+  return true;
+}
+
+template <typename T>
+T GLReplayer::Read() {
+  if constexpr (std::is_pointer_v<T>) {
+    return reinterpret_cast<T>(static_cast<uintptr_t>(Read<uint64_t>()));
+  } else {
+    T value{};
+    if (cursor_ + sizeof(T) > data_.size()) {
+      failed_ = true;
+      return value;
+    }
+    std::memcpy(&value, data_.data() + cursor_, sizeof(T));
+    cursor_ += sizeof(T);
+    return value;
+  }
+}
+
+std::span<const uint8_t> GLReplayer::ReadBlob() {
+  uint64_t size = Read<uint64_t>();
+  if (failed_ || size > data_.size() - cursor_) {
+    failed_ = true;
+    return {};
+  }
+  std::span<const uint8_t> blob(data_.data() + cursor_, size);
+  cursor_ += size;
+  return blob;
+}
+
+unsigned int GLReplayer::Name(char kind, unsigned int captured) {
+  if (captured == 0) return 0;
+  auto& names = names_[static_cast<unsigned char>(kind) & 127];
+  auto it = names.find(captured);
+  // Objects made before capture started keep their captured name.
+  return it == names.end() ? captured : it->second;
+}
+
+int GLReplayer::Location(int captured) {
+  if (captured < 0) return captured;
+  auto it = locations_.find(uint64_t(currentProgram_) << 32 |
+                            static_cast<uint32_t>(captured));
+  return it == locations_.end() ? captured : it->second;
+}
+
+template <typename T>
+T GLReplayer::Map(T value, char kind) {
+  if constexpr (std::is_same_v<T, GLuint>) {
+    if (kind == 'v') return value;
+    GLuint name = Name(kind, value);
+    if (kind == 'p') lastProgram_ = name;
+    return name;
+  } else if constexpr (std::is_same_v<T, GLint>) {
+    return kind == 'u' ? Location(value) : value;
+  } else {
+    return value;
+  }
+}
+
+// Reads every argument of the glad pointer `Slot` as recorded by
+// GenericRecord in gl_capture.cc, maps names, and calls it.
+template <auto* Slot, typename Fn>
+struct GenericReplay;
+
+template <auto* Slot, typename R, typename... A>
+struct GenericReplay<Slot, R(APIENTRYP)(A...)> {
+  static void Run(GLReplayer& replayer, const char* kinds) {
+    // Braced initialization evaluates the reads left to right.
+    std::tuple<A...> args{replayer.Read<A>()...};
+    if (replayer.failed_) return;
+    [&]<size_t... I>(std::index_sequence<I...>) {
+      (*Slot)(replayer.Map(std::get<I>(args), kinds[I])...);
+    }(std::index_sequence_for<A...>{});
+  }
+};
+
+bool GLReplayer::ReplayFrame() {
+  while (!failed_ && cursor_ < data_.size()) {
+    uint16_t op = Read<uint16_t>();
+    switch (static_cast<GLOp>(op)) {
+      case GLOp::kFrameEnd:
+        frames_++;
+        return true;
+
+// `fn` expands to glad's function pointer, as in gl_capture.cc.
+#define REPLAY_GENERIC(fn, kinds)                       \
+  case GLOp::fn:                                        \
+    GenericReplay<&fn, decltype(fn)>::Run(*this, kinds); \
+    break;
+#define REPLAY_NONE(fn)
+        GL_CAPTURE_OPS(REPLAY_GENERIC, REPLAY_NONE)
+#undef REPLAY_GENERIC
+#undef REPLAY_NONE
+
+      default:
+        Special(op);
+        break;
+    }
+    if (static_cast<GLOp>(op) == GLOp::glUseProgram)
+      currentProgram_ = lastProgram_;
+  }
+
+  if (failed_) {
+    std::println(stderr, "Trace is malformed at byte {}.", cursor_);
+  }
+  return false;
+}
+
+void GLReplayer::Special(uint16_t op) {
+  // Generates or deletes objects and updates the name mapping.
+  auto gen = [&](void(APIENTRYP fn)(GLsizei, GLuint*), char kind) {
+    GLsizei n = Read<GLsizei>();
+    for (GLsizei i = 0; i < n; i++) {
+      GLuint captured = Read<GLuint>();
+      if (failed_) return;
+      GLuint name = 0;
+      fn(1, &name);
+      names_[int(kind)][captured] = name;
+    }
+  };
+  auto del = [&](void(APIENTRYP fn)(GLsizei, const GLuint*), char kind) {
+    GLsizei n = Read<GLsizei>();
+    for (GLsizei i = 0; i < n; i++) {
+      GLuint captured = Read<GLuint>();
+      if (failed_) return;
+      GLuint name = Name(kind, captured);
+      fn(1, &name);
+      names_[int(kind)].erase(captured);
+    }
+  };
+  // Pixels recorded by WritePixels in gl_capture.cc.
+  auto pixels = [&]() -> const void* {
+    if (Read<uint8_t>()) return Read<const void*>();
+    std::span<const uint8_t> blob = ReadBlob();
+    return blob.empty() ? nullptr : blob.data();
+  };
+
+  switch (static_cast<GLOp>(op)) {
+    case GLOp::glGenBuffers:
+      gen(glGenBuffers, 'b');
+      break;
+    case GLOp::glGenVertexArrays:
+      gen(glGenVertexArrays, 'a');
+      break;
+    case GLOp::glGenTextures:
+      gen(glGenTextures, 't');
+      break;
+    case GLOp::glGenFramebuffers:
+      gen(glGenFramebuffers, 'f');
+      break;
+    case GLOp::glGenRenderbuffers:
+      gen(glGenRenderbuffers, 'r');
+      break;
+    case GLOp::glGenQueries:
+      gen(glGenQueries, 'q');
+      break;
+    case GLOp::glDeleteBuffers:
+      del(glDeleteBuffers, 'b');
+      break;
+    case GLOp::glDeleteVertexArrays:
+      del(glDeleteVertexArrays, 'a');
+      break;
+    case GLOp::glDeleteTextures:
+      del(glDeleteTextures, 't');
+      break;
+    case GLOp::glDeleteFramebuffers:
+      del(glDeleteFramebuffers, 'f');
+      break;
+    case GLOp::glDeleteRenderbuffers:
+      del(glDeleteRenderbuffers, 'r');
+      break;
+    case GLOp::glDeleteQueries:
+      del(glDeleteQueries, 'q');
+      break;
+
+    case GLOp::glCreateShader: {
+      GLenum type = Read<GLenum>();
+      GLuint captured = Read<GLuint>();
+      if (failed_) break;
+      names_['s'][captured] = glCreateShader(type);
+      break;
+    }
+    case GLOp::glCreateProgram: {
+      GLuint captured = Read<GLuint>();
+      if (failed_) break;
+      names_['p'][captured] = glCreateProgram();
+      break;
+    }
+    case GLOp::glShaderSource: {
+      GLuint shader = Name('s', Read<GLuint>());
+      std::span<const uint8_t> source = ReadBlob();
+      if (failed_) break;
+      const GLchar* text = reinterpret_cast<const GLchar*>(source.data());
+      GLint length = source.size();
+      glShaderSource(shader, 1, &text, &length);
+      break;
+    }
+    case GLOp::glGetUniformLocation: {
+      GLuint program = Name('p', Read<GLuint>());
+      std::span<const uint8_t> blob = ReadBlob();
+      GLint captured = Read<GLint>();
+      if (failed_) break;
+      std::string name(blob.begin(), blob.end());
+      if (captured >= 0) {
+        locations_[uint64_t(program) << 32 | uint32_t(captured)] =
+            glGetUniformLocation(program, name.c_str());
+      }
+      break;
+    }
+    case GLOp::glBindAttribLocation: {
+      GLuint program = Name('p', Read<GLuint>());
+      GLuint index = Read<GLuint>();
+      std::span<const uint8_t> blob = ReadBlob();
+      if (failed_) break;
+      std::string name(blob.begin(), blob.end());
+      glBindAttribLocation(program, index, name.c_str());
+      break;
+    }
+    case GLOp::glTransformFeedbackVaryings: {
+      GLuint program = Name('p', Read<GLuint>());
+      GLsizei count = Read<GLsizei>();
+      std::vector<std::string> names;
+      for (GLsizei i = 0; i < count && !failed_; i++) {
+        std::span<const uint8_t> blob = ReadBlob();
+        names.emplace_back(blob.begin(), blob.end());
+      }
+      GLenum bufferMode = Read<GLenum>();
+      if (failed_) break;
+      std::vector<const GLchar*> varyings;
+      for (const std::string& name : names) varyings.push_back(name.c_str());
+      glTransformFeedbackVaryings(program, varyings.size(), varyings.data(),
+                                  bufferMode);
+      break;
+    }
+
+    case GLOp::glBufferData: {
+      GLenum target = Read<GLenum>();
+      GLsizeiptr size = Read<GLsizeiptr>();
+      GLenum usage = Read<GLenum>();
+      std::span<const uint8_t> data = ReadBlob();
+      if (failed_) break;
+      glBufferData(target, size, data.empty() ? nullptr : data.data(), usage);
+      break;
+    }
+    case GLOp::glBufferSubData: {
+      GLenum target = Read<GLenum>();
+      GLintptr offset = Read<GLintptr>();
+      std::span<const uint8_t> data = ReadBlob();
+      if (failed_) break;
+      glBufferSubData(target, offset, data.size(), data.data());
+      break;
+    }
+    case GLOp::glMapBufferRange: {
+      GLenum target = Read<GLenum>();
+      GLintptr offset = Read<GLintptr>();
+      GLsizeiptr length = Read<GLsizeiptr>();
+      GLbitfield access = Read<GLbitfield>();
+      if (failed_) break;
+      mapped_[target] = static_cast<uint8_t*>(
+          glMapBufferRange(target, offset, length, access));
+      break;
+    }
+    case GLOp::glFlushMappedBufferRange: {
+      GLenum target = Read<GLenum>();
+      GLintptr offset = Read<GLintptr>();
+      std::span<const uint8_t> data = ReadBlob();
+      if (failed_) break;
+      if (uint8_t* memory = mapped_[target]) {
+        std::memcpy(memory + offset, data.data(), data.size());
+        glFlushMappedBufferRange(target, offset, data.size());
+      }
+      break;
+    }
+    case GLOp::glUnmapBuffer: {
+      GLenum target = Read<GLenum>();
+      std::span<const uint8_t> data = ReadBlob();
+      if (failed_) break;
+      if (uint8_t* memory = mapped_[target])
+        std::memcpy(memory, data.data(), data.size());
+      mapped_.erase(target);
+      glUnmapBuffer(target);
+      break;
+    }
+
+    case GLOp::glTexImage2D: {
+      GLenum target = Read<GLenum>();
+      GLint level = Read<GLint>();
+      GLint internalFormat = Read<GLint>();
+      GLsizei width = Read<GLsizei>();
+      GLsizei height = Read<GLsizei>();
+      GLint border = Read<GLint>();
+      GLenum format = Read<GLenum>();
+      GLenum type = Read<GLenum>();
+      const void* data = pixels();
+      if (failed_) break;
+      glTexImage2D(target, level, internalFormat, width, height, border,
+                   format, type, data);
+      break;
+    }
+    case GLOp::glTexSubImage2D: {
+      GLenum target = Read<GLenum>();
+      GLint level = Read<GLint>();
+      GLint x = Read<GLint>();
+      GLint y = Read<GLint>();
+      GLsizei width = Read<GLsizei>();
+      GLsizei height = Read<GLsizei>();
+      GLenum format = Read<GLenum>();
+      GLenum type = Read<GLenum>();
+      const void* data = pixels();
+      if (failed_) break;
+      glTexSubImage2D(target, level, x, y, width, height, format, type, data);
+      break;
+    }
+
+    case GLOp::glUniform1fv:
+    case GLOp::glUniform2fv:
+    case GLOp::glUniform3fv:
+    case GLOp::glUniform4fv:
+    case GLOp::glUniform1iv: {
+      GLint location = Location(Read<GLint>());
+      GLsizei count = Read<GLsizei>();
+      const void* value = ReadBlob().data();
+      if (failed_) break;
+      auto floats = static_cast<const GLfloat*>(value);
+      switch (static_cast<GLOp>(op)) {
+        case GLOp::glUniform1fv:
+          glUniform1fv(location, count, floats);
+          break;
+        case GLOp::glUniform2fv:
+          glUniform2fv(location, count, floats);
+          break;
+        case GLOp::glUniform3fv:
+          glUniform3fv(location, count, floats);
+          break;
+        case GLOp::glUniform4fv:
+          glUniform4fv(location, count, floats);
+          break;
+        default:
+          glUniform1iv(location, count, static_cast<const GLint*>(value));
+          break;
+      }
+      break;
+    }
+    case GLOp::glUniformMatrix3fv:
+    case GLOp::glUniformMatrix4fv: {
+      GLint location = Location(Read<GLint>());
+      GLsizei count = Read<GLsizei>();
+      GLboolean transpose = Read<GLboolean>();
+      auto value = reinterpret_cast<const GLfloat*>(ReadBlob().data());
+      if (failed_) break;
+      if (static_cast<GLOp>(op) == GLOp::glUniformMatrix3fv) {
+        glUniformMatrix3fv(location, count, transpose, value);
+      } else {
+        glUniformMatrix4fv(location, count, transpose, value);
+      }
+      break;
+    }
+
+    case GLOp::glDrawBuffers: {
+      GLsizei n = Read<GLsizei>();
+      std::vector<GLenum> buffers(n > 0 ? n : 0);
+      for (GLenum& buffer : buffers) buffer = Read<GLenum>();
+      if (failed_) break;
+      glDrawBuffers(buffers.size(), buffers.data());
+      break;
+    }
+
+    default:
+      std::println(stderr, "Unknown GL capture op {}.", op);
+      failed_ = true;
+      break;
+  }
+}
+
+void GLReplayer::Release() {
+  auto remove = [&](char kind, auto erase) {
+    for (const auto& [captured, name] : names_[int(kind)]) erase(name);
+    names_[int(kind)].clear();
+  };
+  remove('a', [](GLuint name) { glDeleteVertexArrays(1, &name); });
+  remove('b', [](GLuint name) { glDeleteBuffers(1, &name); });
+  remove('t', [](GLuint name) { glDeleteTextures(1, &name); });
+  remove('f', [](GLuint name) { glDeleteFramebuffers(1, &name); });
+  remove('r', [](GLuint name) { glDeleteRenderbuffers(1, &name); });
+  remove('q', [](GLuint name) { glDeleteQueries(1, &name); });
+  remove('p', [](GLuint name) { glDeleteProgram(name); });
+  remove('s', [](GLuint name) { glDeleteShader(name); });
+  locations_.clear();
+  mapped_.clear();
+  currentProgram_ = lastProgram_ = 0;
+}
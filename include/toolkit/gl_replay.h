@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// Re-executes a trace recorded with StartGLCapture (see gl_capture.h) on
+// the current context.
+//
+// The whole trace is read into memory up front so replay only costs the
+// GL calls themselves. Object names and uniform locations from the
+// capture are mapped to the ones this context hands out.
+class GLReplayer {
+ public:
+  GLReplayer() = default;
+
+  GLReplayer(const GLReplayer&) = delete;
+  GLReplayer& operator=(const GLReplayer&) = delete;
+
+  // Loads the trace at `path`. Returns false if it cannot be read or is
+  // not a capture of a supported version.
+  bool Open(const char* path);
+
+  // Executes commands up to and including the next frame marker. Returns
+  // false once the trace is exhausted or a record is malformed.
+  bool ReplayFrame();
+
+  // Deletes every object the replay created and is still holding, so
+  // another replay on this context starts from the same state. Must be
+  // called while the context is still current.
+  void Release();
+
+  size_t FramesReplayed() const { return frames_; }
+  bool Failed() const { return failed_; }
+
+ private:
+  template <auto* Slot, typename Fn>
+  friend struct GenericReplay;
+
+  template <typename T>
+  T Read();
+  std::span<const uint8_t> ReadBlob();
+
+  // Maps a captured value of namespace `kind` (see gl_capture_ops.h).
+  template <typename T>
+  T Map(T value, char kind);
+  unsigned int Name(char kind, unsigned int captured);
+  int Location(int captured);
+
+  void Special(uint16_t op);
+
+  std::vector<uint8_t> data_;
+  size_t cursor_ = 0;
+  size_t frames_ = 0;
+  bool failed_ = false;
+
+  // Captured to replayed names, per namespace letter.
+  std::unordered_map<unsigned int, unsigned int> names_[128];
+  // (replayed program << 32 | captured location) to replayed location.
+  std::unordered_map<uint64_t, int> locations_;
+  unsigned int currentProgram_ = 0;
+  unsigned int lastProgram_ = 0;
+  // Pointers returned by glMapBufferRange, by target.
+  std::unordered_map<unsigned int, uint8_t*> mapped_;
+};
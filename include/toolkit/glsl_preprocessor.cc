@@ -0,0 +1,286 @@
+#include <glad/glad.h>
+
+#include "glsl_preprocessor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <format>
+#include <print>
+#include <string_view>
+
+#include "shader.h"
+
+namespace fs = std::filesystem;
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+static uint64_t Fnv1a(std::string_view data, uint64_t hash = kFnvOffset) {
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+uint64_t HashDefines(const ShaderDefines& defines) {
+  uint64_t hash = kFnvOffset;
+  for (const auto& [name, value] : defines) {
+    hash = Fnv1a(name, hash);
+    hash = Fnv1a("=", hash);
+    hash = Fnv1a(value, hash);
+    hash = Fnv1a("\n", hash);
+  }
+  return hash;
+}
+
+static bool IsIdentifierChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// Returns the text after `directive` if `line` is that preprocessor
+// directive, allowing whitespace around the '#'. A longer name that
+// starts with `directive`, like #includes, does not match.
+static bool MatchDirective(std::string_view line, std::string_view directive,
+                           std::string_view* rest) {
+  size_t i = line.find_first_not_of(" \t");
+  if (i == std::string_view::npos || line[i] != '#') return false;
+  i = line.find_first_not_of(" \t", i + 1);
+  if (i == std::string_view::npos || !line.substr(i).starts_with(directive))
+    return false;
+  *rest = line.substr(i + directive.size());
+  return rest->empty() || !IsIdentifierChar(rest->front());
+}
+
+// Returns the offset of the first character in `text` that is not
+// whitespace or inside a comment.
+static size_t SkipBlankAndComments(std::string_view text) {
+  size_t i = 0;
+  while (i < text.size()) {
+    if (std::isspace(static_cast<unsigned char>(text[i]))) {
+      i++;
+    } else if (text.substr(i).starts_with("//")) {
+      i = text.find('\n', i);
+      if (i == std::string_view::npos) return text.size();
+    } else if (text.substr(i).starts_with("/*")) {
+      i = text.find("*/", i + 2);
+      if (i == std::string_view::npos) return text.size();
+      i += 2;
+    } else {
+      break;
+    }
+  }
+  return i;
+}
+
+// Extracts the file name from `"name"` or `<name>`.
+static bool ParseIncludeName(std::string_view rest, std::string* name) {
+  size_t open = rest.find_first_of("\"<");
+  if (open == std::string_view::npos) return false;
+  char close = rest[open] == '"' ? '"' : '>';
+  size_t end = rest.find(close, open + 1);
+  if (end == std::string_view::npos) return false;
+  *name = rest.substr(open + 1, end - open - 1);
+  return true;
+}
+
+GlslPreprocessor::GlslPreprocessor() : GlslPreprocessor(ReadFile) {}
+
+GlslPreprocessor::GlslPreprocessor(Loader loader)
+    : loader_(std::move(loader)) {}
+
+void GlslPreprocessor::AddIncludePath(const std::string& dir) {
+  includePaths_.push_back(dir);
+}
+
+bool GlslPreprocessor::Resolve(const std::string& name,
+                               const std::string& from,
+                               std::string* path) const {
+  fs::path local = fs::path(from).parent_path() / name;
+  if (fs::exists(local)) {
+    *path = local.lexically_normal().string();
+    return true;
+  }
+  for (const std::string& dir : includePaths_) {
+    fs::path candidate = fs::path(dir) / name;
+    if (fs::exists(candidate)) {
+      *path = candidate.lexically_normal().string();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool GlslPreprocessor::Expand(const std::string& path, std::string* out,
+                              std::vector<std::string>* files) const {
+  std::string source;
+  if (!loader_(path, &source)) {
+    std::println(stderr, "Failed to read shader source {}", path);
+    return false;
+  }
+
+  size_t fileIndex = files->size();
+  files->push_back(path);
+
+  std::string_view text = source;
+  int lineNumber = 0;
+  while (!text.empty()) {
+    size_t end = text.find('\n');
+    std::string_view line = text.substr(0, end);
+    text = end == std::string_view::npos ? "" : text.substr(end + 1);
+    lineNumber++;
+
+    std::string_view rest;
+    if (!MatchDirective(line, "include", &rest)) {
+      out->append(line);
+      out->push_back('\n');
+      continue;
+    }
+
+    std::string name, resolved;
+    if (!ParseIncludeName(rest, &name) || !Resolve(name, path, &resolved)) {
+      std::println(stderr, "{}:{}: cannot resolve include", path, lineNumber);
+      return false;
+    }
+    if (std::find(files->begin(), files->end(), resolved) == files->end()) {
+      *out += std::format("#line 1 {}\n", files->size());
+      if (!Expand(resolved, out, files)) return false;
+    }
+    *out += std::format("#line {} {}\n", lineNumber + 1, fileIndex);
+  }
+  return true;
+}
+
+bool GlslPreprocessor::Process(const std::string& path,
+                               const ShaderDefines& defines, std::string* out,
+                               std::vector<std::string>* files) const {
+  std::vector<std::string> read;
+  std::string body;
+  if (!Expand(path, &body, &read)) return false;
+  if (files != nullptr) files->insert(files->end(), read.begin(), read.end());
+
+  // #version has to stay the first statement, so defines go after it and
+  // a #line directive restores the numbering of the original file. Only
+  // blank lines and comments may come before it.
+  out->clear();
+  std::string_view text = body;
+  std::string_view rest;
+  size_t start = SkipBlankAndComments(text);
+  size_t lineEnd = text.find('\n', start);
+  int versionLine = 0;
+  if (MatchDirective(text.substr(start, lineEnd - start), "version", &rest)) {
+    std::string_view head = text.substr(0, lineEnd + 1);
+    out->append(head);
+    text = text.substr(head.size());
+    versionLine = std::ranges::count(head, '\n');
+  }
+  for (const auto& [name, value] : defines)
+    *out += std::format("#define {} {}\n", name, value);
+  if (!defines.empty()) *out += std::format("#line {} 0\n", versionLine + 1);
+  out->append(text);
+  return true;
+}
+
+ShaderVariantCache::ShaderVariantCache(const GlslPreprocessor& preprocessor,
+                                       size_t budget)
+    : preprocessor_(preprocessor), budget_(budget) {}
+
+unsigned int ShaderVariantCache::Get(const std::string& vertexPath,
+                                     const std::string& fragmentPath,
+                                     const ShaderDefines& defines) {
+  uint64_t key = Fnv1a(vertexPath);
+  key = Fnv1a(fragmentPath, Fnv1a("\n", key));
+  key ^= HashDefines(defines) * kFnvPrime;
+
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    entries_.splice(entries_.begin(), entries_, it->second);
+  } else {
+    entries_.push_front({.key = key,
+                         .vertexPath = vertexPath,
+                         .fragmentPath = fragmentPath,
+                         .defines = defines});
+    index_[key] = entries_.begin();
+  }
+
+  Entry& entry = entries_.front();
+  entry.lastUsedFrame = frame_;
+  if (entry.generation != generation_ && entry.pending == 0)
+    StartBuild(entry);
+  return entry.program;
+}
+
+void ShaderVariantCache::StartBuild(Entry& entry) {
+  // On failure the generation is still recorded, so the variant waits
+  // for the next Invalidate() instead of repeating the same errors.
+  entry.generation = generation_;
+  std::string vertexSource, fragmentSource;
+  if (!preprocessor_.Process(entry.vertexPath, entry.defines,
+                             &vertexSource) ||
+      !preprocessor_.Process(entry.fragmentPath, entry.defines,
+                             &fragmentSource))
+    return;
+
+  entry.pending = StartProgramLink(
+      StartShaderCompile(GL_VERTEX_SHADER, vertexSource.c_str()),
+      StartShaderCompile(GL_FRAGMENT_SHADER, fragmentSource.c_str()));
+  // Driver memory for a program is not observable on GL 3.3, so the
+  // expanded source size stands in for it.
+  entry.pendingBytes = vertexSource.size() + fragmentSource.size();
+  entry.pendingFrames = 0;
+}
+
+void ShaderVariantCache::FinishBuild(Entry& entry) {
+  if (++entry.pendingFrames < kStatusDelayFrames ||
+      !IsProgramLinkComplete(entry.pending))
+    return;
+
+  if (!CheckProgramLink(entry.pending)) {
+    if (entry.program != 0) {
+      std::println(stderr, "Keeping previous variant of {} and {}",
+                   entry.vertexPath, entry.fragmentPath);
+    }
+    glDeleteProgram(entry.pending);
+  } else {
+    if (entry.program != 0) glDeleteProgram(entry.program);
+    entry.program = entry.pending;
+    bytes_ += entry.pendingBytes - entry.bytes;
+    entry.bytes = entry.pendingBytes;
+  }
+  entry.pending = 0;
+}
+
+void ShaderVariantCache::Update() {
+  frame_++;
+  for (Entry& entry : entries_) {
+    if (entry.pending != 0) FinishBuild(entry);
+  }
+  Evict();
+}
+
+void ShaderVariantCache::Invalidate() { generation_++; }
+
+void ShaderVariantCache::Evict() {
+  // Anything used last frame may still be drawn with this frame, and
+  // the list is ordered by use, so stop at the first such entry.
+  while (bytes_ > budget_ && !entries_.empty() &&
+         entries_.back().lastUsedFrame + 1 < frame_) {
+    const Entry& victim = entries_.back();
+    if (victim.program != 0) glDeleteProgram(victim.program);
+    if (victim.pending != 0) glDeleteProgram(victim.pending);
+    bytes_ -= victim.bytes;
+    index_.erase(victim.key);
+    entries_.pop_back();
+  }
+}
+
+void ShaderVariantCache::Clear() {
+  for (const Entry& entry : entries_) {
+    if (entry.program != 0) glDeleteProgram(entry.program);
+    if (entry.pending != 0) glDeleteProgram(entry.pending);
+  }
+  entries_.clear();
+  index_.clear();
+  bytes_ = 0;
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Preprocessor defines injected into a shader, e.g. {"COLOR", "vec4(1.0)"}.
+// An empty value defines the name without a body. Ordered so equal sets
+// always hash the same.
+using ShaderDefines = std::map<std::string, std::string>;
+
+// FNV-1a hash of a define set.
+uint64_t HashDefines(const ShaderDefines& defines);
+
+// Expands #include directives and injects defines into GLSL sources so
+// feature permutations can share a single file.
+//
+// Includes are resolved relative to the including file first, then
+// against the include paths, and each file is pasted at most once per
+// expansion. #include is expanded regardless of surrounding #if blocks.
+// Every pasted file is announced with a #line directive whose source
+// string number is the file's index in the dependency list, so compiler
+// errors can be mapped back to it.
+class GlslPreprocessor {
+ public:
+  // Reads a source file. Returns false if it does not exist.
+  using Loader = std::function<bool(const std::string& path, std::string*)>;
+
+  // Reads sources straight from disk.
+  GlslPreprocessor();
+  explicit GlslPreprocessor(Loader loader);
+
+  void AddIncludePath(const std::string& dir);
+
+  // Expands the file at `path` into `out`, inserting `defines` right
+  // after its #version line. Files read are appended to `files` in
+  // source string order when it is not null. Returns false and reports
+  // the missing file if anything could not be read.
+  bool Process(const std::string& path, const ShaderDefines& defines,
+               std::string* out,
+               std::vector<std::string>* files = nullptr) const;
+
+ private:
+  bool Expand(const std::string& path, std::string* out,
+              std::vector<std::string>* files) const;
+  bool Resolve(const std::string& name, const std::string& from,
+               std::string* path) const;
+
+  Loader loader_;
+  std::vector<std::string> includePaths_;
+};
+
+// Compiled shader variants keyed by source files and define set, kept
+// under a memory budget.
+//
+// Variants are compiled without waiting on the driver: Get() starts the
+// build and returns 0 until Update() sees the link complete. After
+// Invalidate() each variant keeps its previous program until the rebuild
+// links, and a failed rebuild leaves it in use. Variants are evicted
+// least recently used first once their combined source size exceeds the
+// budget, but only after going unused for a whole frame, so a program
+// returned by Get() stays valid through the next Update().
+class ShaderVariantCache {
+ public:
+  ShaderVariantCache(const GlslPreprocessor& preprocessor, size_t budget);
+
+  ShaderVariantCache(const ShaderVariantCache&) = delete;
+  ShaderVariantCache& operator=(const ShaderVariantCache&) = delete;
+
+  // Returns the program for this permutation, starting a build if it has
+  // none or its sources were invalidated. Returns 0 while the first build
+  // is in flight, or if it failed; a failed build is retried only after
+  // the next Invalidate().
+  unsigned int Get(const std::string& vertexPath,
+                   const std::string& fragmentPath,
+                   const ShaderDefines& defines);
+
+  // Swaps in finished builds, then evicts over budget. Call once per
+  // frame, before any Get().
+  void Update();
+
+  // Marks every variant out of date, so the next Get() of each rebuilds
+  // it from the current sources.
+  void Invalidate();
+
+  // Deletes every cached and in-flight program. Must be called while the
+  // context is still current.
+  void Clear();
+
+  size_t Size() const { return bytes_; }
+  size_t Count() const { return entries_.size(); }
+
+ private:
+  // As in HotProgram, wait a few frames before asking for link status on
+  // drivers that cannot report progress.
+  static constexpr int kStatusDelayFrames = 3;
+
+  struct Entry {
+    uint64_t key;
+    std::string vertexPath, fragmentPath;
+    ShaderDefines defines;
+    // Cache generation the latest build started in; 0 before the first.
+    uint64_t generation = 0;
+    uint64_t lastUsedFrame = 0;
+    unsigned int program = 0;
+    size_t bytes = 0;
+    unsigned int pending = 0;
+    size_t pendingBytes = 0;
+    int pendingFrames = 0;
+  };
+
+  void StartBuild(Entry& entry);
+  void FinishBuild(Entry& entry);
+  void Evict();
+
+  const GlslPreprocessor& preprocessor_;
+  size_t budget_;
+  size_t bytes_ = 0;
+  uint64_t generation_ = 1;
+  uint64_t frame_ = 0;
+  // Most recently used first.
+  std::list<Entry> entries_;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> index_;
+};
@@ -0,0 +1,158 @@
+#include <glad/glad.h>
+
+#include "gpu_cull.h"
+
+#include <cstddef>
+#include <print>
+
+#include "shader.h"
+
+static const char* kCullVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec4 aSphere;
+layout (location = 1) in vec4 aData;
+
+uniform vec4 uPlanes[6];
+
+out vec4 vSphere;
+out vec4 vData;
+flat out int vVisible;
+
+void main() {
+  vVisible = 1;
+  for (int i = 0; i < 6; i++) {
+    if (dot(uPlanes[i].xyz, aSphere.xyz) + uPlanes[i].w < -aSphere.w)
+      vVisible = 0;
+  }
+  vSphere = aSphere;
+  vData = aData;
+}
+)";
+
+static const char* kCullGeometryShader = R"(
+#version 330 core
+layout (points) in;
+layout (points, max_vertices = 1) out;
+
+in vec4 vSphere[];
+in vec4 vData[];
+flat in int vVisible[];
+
+out vec4 oSphere;
+out vec4 oData;
+
+void main() {
+  if (vVisible[0] != 0) {
+    oSphere = vSphere[0];
+    oData = vData[0];
+    EmitVertex();
+  }
+}
+)";
+
+bool GpuCuller::Init(size_t maxInstances) {
+  unsigned int vs = StartShaderCompile(GL_VERTEX_SHADER, kCullVertexShader);
+  unsigned int gs =
+      StartShaderCompile(GL_GEOMETRY_SHADER, kCullGeometryShader);
+
+  // Varyings have to be declared before linking, so this does not go
+  // through StartProgramLink.
+  program_ = glCreateProgram();
+  glAttachShader(program_, vs);
+  glAttachShader(program_, gs);
+  const char* varyings[] = {"oSphere", "oData"};
+  glTransformFeedbackVaryings(program_, 2, varyings, GL_INTERLEAVED_ATTRIBS);
+  glLinkProgram(program_);
+  glDeleteShader(vs);
+  glDeleteShader(gs);
+  if (!CheckProgramLink(program_)) {
+    glDeleteProgram(program_);
+    program_ = 0;
+    return false;
+  }
+  planesLocation_ = glGetUniformLocation(program_, "uPlanes");
+
+  capacity_ = maxInstances;
+  for (Slot& slot : slots_) {
+    glGenBuffers(1, &slot.buffer);
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, slot.buffer);
+    glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER,
+                 capacity_ * sizeof(CullInstance), NULL, GL_DYNAMIC_COPY);
+    glGenQueries(1, &slot.query);
+  }
+  glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, 0);
+
+  glGenVertexArrays(1, &vao_);
+  return true;
+}
+
+void GpuCuller::Cull(unsigned int buffer, size_t count,
+                     const float planes[6][4]) {
+  if (count > capacity_) {
+    std::println(stderr, "Culling {} instances, only sized for {}", count,
+                 capacity_);
+    count = capacity_;
+  }
+
+  Slot& slot = slots_[passes_ % kSlots];
+  passes_++;
+
+  glBindVertexArray(vao_);
+  glBindBuffer(GL_ARRAY_BUFFER, buffer);
+  glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(CullInstance),
+                        (void*)0);
+  glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(CullInstance),
+                        (void*)offsetof(CullInstance, data));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+
+  glUseProgram(program_);
+  glUniform4fv(planesLocation_, 6, &planes[0][0]);
+
+  glEnable(GL_RASTERIZER_DISCARD);
+  glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, slot.buffer);
+  glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, slot.query);
+  glBeginTransformFeedback(GL_POINTS);
+  glDrawArrays(GL_POINTS, 0, count);
+  glEndTransformFeedback();
+  glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+  glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+  glDisable(GL_RASTERIZER_DISCARD);
+
+  glUseProgram(0);
+  glBindVertexArray(0);
+
+  slot.pass = passes_;
+  slot.pending = true;
+}
+
+bool GpuCuller::Result(unsigned int* buffer, unsigned int* count) {
+  Slot* newest = nullptr;
+  for (Slot& slot : slots_) {
+    if (slot.pending) {
+      int available = GL_FALSE;
+      glGetQueryObjectiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+      if (!available) continue;
+      glGetQueryObjectuiv(slot.query, GL_QUERY_RESULT, &slot.count);
+      slot.pending = false;
+    }
+    if (slot.pass != 0 && (newest == nullptr || slot.pass > newest->pass))
+      newest = &slot;
+  }
+
+  if (newest == nullptr) return false;
+  *buffer = newest->buffer;
+  *count = newest->count;
+  return true;
+}
+
+void GpuCuller::Release() {
+  for (Slot& slot : slots_) {
+    glDeleteBuffers(1, &slot.buffer);
+    glDeleteQueries(1, &slot.query);
+    slot = Slot();
+  }
+  glDeleteVertexArrays(1, &vao_);
+  glDeleteProgram(program_);
+  vao_ = program_ = 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+
+// One cullable instance: a bounding sphere and a vec4 of payload that is
+// carried through to the surviving instance list.
+struct CullInstance {
+  float center[3];
+  float radius;
+  float data[4];
+};
+static_assert(sizeof(CullInstance) == 32);
+
+// Culls instances against a frustum on the GPU.
+//
+// A vertex shader tests every instance's bounding sphere against the six
+// planes with rasterization disabled, and a geometry shader emits only
+// the instances that pass, which transform feedback packs into an output
+// buffer. Only the survivors are then drawn, without the CPU touching
+// per-instance data.
+//
+// The survivor count comes from a GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN
+// query. Reading it right away would stall, so outputs rotate through a
+// small ring and Result() returns the newest one whose count is already
+// known, typically a frame or two old. Bounds should be padded by how
+// far the camera can move in that time.
+class GpuCuller {
+ public:
+  GpuCuller() = default;
+
+  GpuCuller(const GpuCuller&) = delete;
+  GpuCuller& operator=(const GpuCuller&) = delete;
+
+  // Builds the culling program and sizes the outputs for `maxInstances`.
+  // Returns false if the program fails to build.
+  bool Init(size_t maxInstances);
+
+  // Culls `count` CullInstance records from `buffer` against `planes`,
+  // each (a, b, c, d) keeping points where a*x + b*y + c*z + d >= 0.
+  void Cull(unsigned int buffer, size_t count, const float planes[6][4]);
+
+  // Buffer of CullInstance records and how many survived, for the newest
+  // pass whose count is available. Returns false before any is.
+  bool Result(unsigned int* buffer, unsigned int* count);
+
+  // Deletes every GL object. Must be called while the context is still
+  // current.
+  void Release();
+
+ private:
+  static constexpr int kSlots = 3;
+
+  struct Slot {
+    unsigned int buffer = 0;
+    unsigned int query = 0;
+    unsigned int count = 0;
+    // Pass number that wrote this slot; 0 while unused.
+    unsigned long long pass = 0;
+    bool pending = false;
+  };
+
+  unsigned int program_ = 0;
+  unsigned int vao_ = 0;
+  int planesLocation_ = -1;
+  size_t capacity_ = 0;
+  unsigned long long passes_ = 0;
+  Slot slots_[kSlots];
+};
@@ -0,0 +1,99 @@
+#include <glad/glad.h>
+
+#include "hot_program.h"
+
+#include <print>
+
+#include "shader.h"
+
+HotProgram::HotProgram(FileWatcher& watcher)
+    : watcher_(watcher),
+      preprocessor_([this](const std::string& path, std::string* out) {
+        // Sources come from the watcher so includes are watched as well.
+        uint64_t version = 0;
+        if (!watcher_.Watch(path) || !watcher_.Latest(path, &version, out))
+          return false;
+        versions_[path] = version;
+        return true;
+      }) {}
+
+void HotProgram::Release() {
+  if (pending_ != 0) glDeleteProgram(pending_);
+  if (program_ != 0) glDeleteProgram(program_);
+  pending_ = program_ = 0;
+}
+
+bool HotProgram::Preprocess(std::string* vertexSource,
+                            std::string* fragmentSource) {
+  return preprocessor_.Process(vertexPath_, defines_, vertexSource) &&
+         preprocessor_.Process(fragmentPath_, defines_, fragmentSource);
+}
+
+bool HotProgram::Load(const std::string& vertexPath,
+                      const std::string& fragmentPath,
+                      const ShaderDefines& defines) {
+  return Prepare(vertexPath, fragmentPath, defines) && Load();
+}
+
+bool HotProgram::Prepare(const std::string& vertexPath,
+                         const std::string& fragmentPath,
+                         const ShaderDefines& defines) {
+  vertexPath_ = vertexPath;
+  fragmentPath_ = fragmentPath;
+  defines_ = defines;
+  return Preprocess(&preparedVertex_, &preparedFragment_);
+}
+
+bool HotProgram::Load() {
+  unsigned int program = CompileShaderProgram(preparedVertex_.c_str(),
+                                              preparedFragment_.c_str());
+  preparedVertex_.clear();
+  preparedFragment_.clear();
+  if (program == 0) return false;
+
+  if (program_ != 0) glDeleteProgram(program_);
+  program_ = program;
+  return true;
+}
+
+void HotProgram::Update() {
+  if (pending_ != 0) {
+    FinishRebuild();
+    return;
+  }
+
+  bool changed = false;
+  std::string unused;
+  for (auto& [path, version] : versions_)
+    changed |= watcher_.Latest(path, &version, &unused);
+  if (changed) StartRebuild();
+}
+
+void HotProgram::StartRebuild() {
+  // On failure versions_ already records what was read, so the next
+  // save of any file retries.
+  std::string vertexSource, fragmentSource;
+  if (!Preprocess(&vertexSource, &fragmentSource)) return;
+
+  pending_ = StartProgramLink(
+      StartShaderCompile(GL_VERTEX_SHADER, vertexSource.c_str()),
+      StartShaderCompile(GL_FRAGMENT_SHADER, fragmentSource.c_str()));
+  pendingFrames_ = 0;
+}
+
+void HotProgram::FinishRebuild() {
+  if (++pendingFrames_ < kStatusDelayFrames ||
+      !IsProgramLinkComplete(pending_))
+    return;
+
+  if (!CheckProgramLink(pending_)) {
+    std::println(stderr, "Keeping previous program for {} and {}",
+                 vertexPath_, fragmentPath_);
+    glDeleteProgram(pending_);
+  } else {
+    glDeleteProgram(program_);
+    program_ = pending_;
+    std::println("Reloaded {} and {}", vertexPath_, fragmentPath_);
+  }
+  pending_ = 0;
+}
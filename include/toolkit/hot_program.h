@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "file_watcher.h"
+#include "glsl_preprocessor.h"
+
+// A shader program loaded from a vertex and fragment shader file that is
+// rebuilt whenever either file, or anything they #include, changes on
+// disk.
+//
+// Rebuilds are started by Update() and polled on later calls, so the
+// frame loop never waits on the compiler. The new program replaces the
+// old one only from Update(), which callers run at the start of a frame,
+// so every draw in a frame sees the same program. A failed rebuild is
+// reported and the previous program stays in use.
+class HotProgram {
+ public:
+  explicit HotProgram(FileWatcher& watcher);
+
+  HotProgram(const HotProgram&) = delete;
+  HotProgram& operator=(const HotProgram&) = delete;
+
+  // Reads, preprocesses with `defines`, compiles and links the program,
+  // blocking until done. Returns false if a file is unreadable or the
+  // program fails to build.
+  bool Load(const std::string& vertexPath, const std::string& fragmentPath,
+            const ShaderDefines& defines = {});
+
+  // The two halves of Load(). Prepare() reads and preprocesses the
+  // sources without touching GL, so it can run on a worker thread while
+  // the context is created; Load() then only compiles and links.
+  bool Prepare(const std::string& vertexPath, const std::string& fragmentPath,
+               const ShaderDefines& defines = {});
+  bool Load();
+
+  // Include directories searched by the preprocessor.
+  void AddIncludePath(const std::string& dir) {
+    preprocessor_.AddIncludePath(dir);
+  }
+
+  // Starts a rebuild if a source changed, or swaps in a finished one.
+  // Call once per frame, before any draws.
+  void Update();
+
+  // The program to draw with this frame.
+  unsigned int Program() const { return program_; }
+
+  // Deletes the current and any in-flight program. Must be called while
+  // the context is still current.
+  void Release();
+
+ private:
+  // Drivers without KHR_parallel_shader_compile cannot report progress,
+  // but most still compile on a helper thread. Waiting a few frames
+  // before asking for the link status keeps that query from stalling.
+  static constexpr int kStatusDelayFrames = 3;
+
+  bool Preprocess(std::string* vertexSource, std::string* fragmentSource);
+  void StartRebuild();
+  void FinishRebuild();
+
+  FileWatcher& watcher_;
+  GlslPreprocessor preprocessor_;
+  std::string vertexPath_, fragmentPath_;
+  ShaderDefines defines_;
+  // Watcher version of every file the sources were built from.
+  std::unordered_map<std::string, uint64_t> versions_;
+
+  // Sources from Prepare() waiting for Load().
+  std::string preparedVertex_, preparedFragment_;
+
+  unsigned int program_ = 0;
+  unsigned int pending_ = 0;
+  int pendingFrames_ = 0;
+};
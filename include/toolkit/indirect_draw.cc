@@ -0,0 +1,124 @@
+#include <glad/glad.h>
+
+#include "indirect_draw.h"
+
+#include "capabilities.h"
+#include "parallel.h"
+
+// Commands per worker range when filling the list.
+constexpr size_t kFillGrain = 1024;
+
+static size_t IndexSize(unsigned int type) {
+  switch (type) {
+    case GL_UNSIGNED_BYTE:
+      return 1;
+    case GL_UNSIGNED_SHORT:
+      return 2;
+    default:
+      return 4;
+  }
+}
+
+IndirectDrawList::IndirectDrawList() {
+  const GLCapabilities& caps = Capabilities();
+  if (caps.multiDrawIndirect && caps.baseInstance) {
+    path_ = Path::kMultiDrawIndirect;
+  } else if (caps.baseInstance) {
+    path_ = Path::kBaseInstanceLoop;
+  } else {
+    path_ = Path::kEmulated;
+  }
+}
+
+void IndirectDrawList::Fill(
+    size_t count,
+    const std::function<void(size_t, size_t, DrawElementsIndirectCommand*)>&
+        fill) {
+  commands_.resize(count);
+  DrawElementsIndirectCommand* commands = commands_.data();
+  ParallelFor(count, kFillGrain, [&](size_t begin, size_t end) {
+    fill(begin, end, commands);
+  });
+}
+
+void IndirectDrawList::SetInstanceAttributes(
+    unsigned int buffer, std::vector<InstanceAttribute> attributes) {
+  instanceBuffer_ = buffer;
+  instanceAttributes_ = std::move(attributes);
+}
+
+void IndirectDrawList::Submit(unsigned int mode, unsigned int indexType) {
+  if (commands_.empty()) return;
+
+  if (path_ == Path::kMultiDrawIndirect) {
+    SubmitIndirect(mode, indexType);
+  } else {
+    SubmitLoop(mode, indexType);
+  }
+}
+
+void IndirectDrawList::SubmitIndirect(unsigned int mode,
+                                      unsigned int indexType) {
+  size_t bytes = commands_.size() * sizeof(DrawElementsIndirectCommand);
+  if (indirectBuffer_ == 0) glGenBuffers(1, &indirectBuffer_);
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer_);
+
+  // Orphan the previous contents instead of overwriting storage the GPU
+  // may still be reading from.
+  if (bytes > indirectCapacity_) indirectCapacity_ = bytes;
+  glBufferData(GL_DRAW_INDIRECT_BUFFER, indirectCapacity_, NULL,
+               GL_STREAM_DRAW);
+  glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, bytes, commands_.data());
+
+  glMultiDrawElementsIndirect(mode, indexType, (void*)0, commands_.size(),
+                              0);
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+void IndirectDrawList::PointInstanceAttributes(uint32_t baseInstance) {
+  glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer_);
+  for (const InstanceAttribute& attr : instanceAttributes_) {
+    const void* offset =
+        (const void*)(attr.offset + (size_t)baseInstance * attr.stride);
+    if (attr.integer) {
+      glVertexAttribIPointer(attr.location, attr.size, attr.type, attr.stride,
+                             offset);
+    } else {
+      glVertexAttribPointer(attr.location, attr.size, attr.type, GL_FALSE,
+                            attr.stride, offset);
+    }
+  }
+}
+
+void IndirectDrawList::SubmitLoop(unsigned int mode, unsigned int indexType) {
+  size_t indexSize = IndexSize(indexType);
+  bool emulated = path_ == Path::kEmulated && !instanceAttributes_.empty();
+  uint32_t pointedAt = 0;
+
+  for (const DrawElementsIndirectCommand& cmd : commands_) {
+    if (cmd.count == 0 || cmd.instanceCount == 0) continue;
+    const void* indices = (const void*)(cmd.firstIndex * indexSize);
+
+    if (path_ == Path::kBaseInstanceLoop) {
+      glDrawElementsInstancedBaseVertexBaseInstance(
+          mode, cmd.count, indexType, indices, cmd.instanceCount,
+          cmd.baseVertex, cmd.baseInstance);
+      continue;
+    }
+
+    if (emulated && cmd.baseInstance != pointedAt) {
+      PointInstanceAttributes(cmd.baseInstance);
+      pointedAt = cmd.baseInstance;
+    }
+    glDrawElementsInstancedBaseVertex(mode, cmd.count, indexType, indices,
+                                      cmd.instanceCount, cmd.baseVertex);
+  }
+
+  if (emulated && pointedAt != 0) PointInstanceAttributes(0);
+}
+
+void IndirectDrawList::Release() {
+  if (indirectBuffer_ != 0) glDeleteBuffers(1, &indirectBuffer_);
+  indirectBuffer_ = 0;
+  indirectCapacity_ = 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// One indexed draw, laid out the way GL reads it from
+// GL_DRAW_INDIRECT_BUFFER.
+struct DrawElementsIndirectCommand {
+  uint32_t count;
+  uint32_t instanceCount;
+  uint32_t firstIndex;
+  int32_t baseVertex;
+  uint32_t baseInstance;
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20);
+
+// A per-instance vertex attribute (divisor 1) in the instance buffer.
+struct InstanceAttribute {
+  unsigned int location;
+  int size;
+  unsigned int type;
+  int stride;
+  size_t offset;
+  // Read with glVertexAttribIPointer instead of glVertexAttribPointer.
+  bool integer = false;
+};
+
+// A list of indexed draws submitted with a single call.
+//
+// With GL_ARB_multi_draw_indirect the list is uploaded to an indirect
+// buffer and drawn with one glMultiDrawElementsIndirect. Without it the
+// commands are replayed in a loop: with glDrawElementsInstancedBase-
+// VertexBaseInstance when GL_ARB_base_instance is present, otherwise on
+// plain GL 3.3 by re-pointing the instance attributes at each command's
+// base instance before drawing.
+class IndirectDrawList {
+ public:
+  enum class Path { kMultiDrawIndirect, kBaseInstanceLoop, kEmulated };
+
+  // Picks the submission path, so the context must be current.
+  IndirectDrawList();
+
+  IndirectDrawList(const IndirectDrawList&) = delete;
+  IndirectDrawList& operator=(const IndirectDrawList&) = delete;
+
+  // Resizes the list to `count` commands and has `fill` write them,
+  // split into ranges across worker threads.
+  void Fill(size_t count,
+            const std::function<void(size_t begin, size_t end,
+                                     DrawElementsIndirectCommand* commands)>&
+                fill);
+
+  std::vector<DrawElementsIndirectCommand>& Commands() { return commands_; }
+
+  // Describes where per-instance attributes live, for the emulated path.
+  // Ignored when the driver applies base instances itself.
+  void SetInstanceAttributes(unsigned int buffer,
+                             std::vector<InstanceAttribute> attributes);
+
+  // Draws every command with the currently bound program and vertex
+  // array. `indexType` is the element buffer's index type.
+  void Submit(unsigned int mode, unsigned int indexType);
+
+  // Deletes the indirect buffer. Must be called while the context is
+  // still current.
+  void Release();
+
+  Path path() const { return path_; }
+
+ private:
+  void SubmitIndirect(unsigned int mode, unsigned int indexType);
+  void SubmitLoop(unsigned int mode, unsigned int indexType);
+  void PointInstanceAttributes(uint32_t baseInstance);
+
+  Path path_;
+  std::vector<DrawElementsIndirectCommand> commands_;
+
+  unsigned int indirectBuffer_ = 0;
+  size_t indirectCapacity_ = 0;
+
+  unsigned int instanceBuffer_ = 0;
+  std::vector<InstanceAttribute> instanceAttributes_;
+};
@@ -0,0 +1,294 @@
+#include "job_system.h"
+
+#include <algorithm>
+
+struct Job {
+  std::function<void()> fn;
+  JobCounter* counter;
+};
+
+// Initial slots per worker deque; it grows when full.
+constexpr int64_t kDequeCapacity = 1024;
+// Attempts to find work before an idle worker goes to sleep.
+constexpr int kIdleSpins = 64;
+// Ranges per thread in ParallelFor, so stealing can even out ranges that
+// take longer than others.
+constexpr size_t kRangesPerThread = 4;
+
+// The system the current thread works for and its deque there.
+static thread_local const JobSystem* tSystem = nullptr;
+static thread_local unsigned int tWorker = 0;
+
+/*
+ * Chase-Lev Deque
+ */
+
+// Work-stealing deque after Chase and Lev, with the memory orderings of
+// Le et al., "Correct and Efficient Work-Stealing for Weak Memory
+// Models". Only the owning worker pushes and pops at the bottom; any
+// thread may steal from the top.
+class JobSystem::Deque {
+ public:
+  Deque() : array_(new Array(kDequeCapacity)) {}
+  ~Deque() { delete array_.load(std::memory_order_relaxed); }
+
+  void Push(Job* job) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Array* a = array_.load(std::memory_order_relaxed);
+    if (b - t > a->capacity - 1) a = Grow(a, t, b);
+    a->Put(b, job);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  Job* Pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    Job* job = a->Get(b);
+    if (t == b) {
+      // Last job: race thieves for it.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        job = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+  }
+
+  Job* Steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+
+    Array* a = array_.load(std::memory_order_acquire);
+    Job* job = a->Get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return job;
+  }
+
+ private:
+  struct Array {
+    explicit Array(int64_t capacity)
+        : capacity(capacity), slots(new std::atomic<Job*>[capacity]) {}
+
+    Job* Get(int64_t i) const {
+      return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t i, Job* job) {
+      slots[i & (capacity - 1)].store(job, std::memory_order_relaxed);
+    }
+
+    int64_t capacity;
+    std::unique_ptr<std::atomic<Job*>[]> slots;
+  };
+
+  Array* Grow(Array* old, int64_t top, int64_t bottom) {
+    Array* grown = new Array(old->capacity * 2);
+    for (int64_t i = top; i < bottom; i++) grown->Put(i, old->Get(i));
+    // Thieves may still be reading the old array, so it is only freed
+    // with the deque.
+    retired_.emplace_back(old);
+    array_.store(grown, std::memory_order_release);
+    return grown;
+  }
+
+  std::atomic<int64_t> top_ = 0;
+  std::atomic<int64_t> bottom_ = 0;
+  std::atomic<Array*> array_;
+  std::vector<std::unique_ptr<Array>> retired_;
+};
+
+/*
+ * Counters
+ */
+
+bool JobCounter::Done() const {
+  if (value_.load(std::memory_order_acquire) != 0) return false;
+  // The finishing thread drops the lock only after its last access.
+  std::lock_guard lock(mutex_);
+  return true;
+}
+
+/*
+ * Job System
+ */
+
+unsigned int JobSystem::DefaultWorkerCount() {
+  return std::max(1u, std::thread::hardware_concurrency()) - 1;
+}
+
+JobSystem::JobSystem(unsigned int workers) {
+  for (unsigned int i = 0; i < workers; i++)
+    deques_.push_back(std::make_unique<Deque>());
+  for (unsigned int i = 0; i < workers; i++) {
+    workers_.emplace_back(
+        [this, i](std::stop_token stop) { WorkerLoop(i, stop); });
+  }
+}
+
+JobSystem::~JobSystem() {
+  for (std::jthread& worker : workers_) worker.request_stop();
+  epoch_.fetch_add(1, std::memory_order_release);
+  epoch_.notify_all();
+  workers_.clear();
+}
+
+void JobSystem::Run(std::function<void()> fn, JobCounter* counter,
+                    JobCounter* after) {
+  Job* job = new Job{std::move(fn), counter};
+  if (counter) counter->value_.fetch_add(1, std::memory_order_relaxed);
+
+  if (after) {
+    std::lock_guard lock(after->mutex_);
+    if (after->value_.load(std::memory_order_acquire) != 0) {
+      after->dependents_.push_back(job);
+      return;
+    }
+  }
+  Push(job);
+}
+
+void JobSystem::Wait(JobCounter& counter, bool help) {
+  if (!help) {
+    int value;
+    while ((value = counter.value_.load(std::memory_order_acquire)) != 0)
+      counter.value_.wait(value);
+    std::lock_guard lock(counter.mutex_);
+    return;
+  }
+
+  while (!counter.Done()) {
+    if (Job* job = Find()) {
+      Execute(job);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::ParallelFor(
+    size_t count, size_t grain,
+    const std::function<void(size_t begin, size_t end)>& fn) {
+  if (count == 0) return;
+
+  size_t threads = WorkerCount() + 1;
+  size_t chunks = std::clamp<size_t>(count / std::max<size_t>(grain, 1), 1,
+                                     threads * kRangesPerThread);
+  size_t chunk = (count + chunks - 1) / chunks;
+
+  JobCounter counter;
+  for (size_t begin = chunk; begin < count; begin += chunk) {
+    size_t end = std::min(begin + chunk, count);
+    Run([&fn, begin, end] { fn(begin, end); }, &counter);
+  }
+  fn(0, std::min(chunk, count));
+  Wait(counter);
+}
+
+void JobSystem::WorkerLoop(unsigned int index, std::stop_token stop) {
+  tSystem = this;
+  tWorker = index;
+
+  while (true) {
+    if (Job* job = Find()) {
+      Execute(job);
+      continue;
+    }
+
+    // Read the epoch before the last look for work, so a push that lands
+    // after that look changes it and the wait returns immediately.
+    uint32_t epoch = epoch_.load(std::memory_order_acquire);
+    Job* job = nullptr;
+    for (int spin = 0; spin < kIdleSpins && !job; spin++) {
+      job = Find();
+      if (!job) std::this_thread::yield();
+    }
+    if (job) {
+      Execute(job);
+      continue;
+    }
+
+    if (stop.stop_requested()) break;
+    epoch_.wait(epoch, std::memory_order_acquire);
+  }
+}
+
+void JobSystem::Push(Job* job) {
+  if (tSystem == this) {
+    deques_[tWorker]->Push(job);
+  } else {
+    std::lock_guard lock(injectMutex_);
+    injected_.push_back(job);
+    injectedCount_.fetch_add(1, std::memory_order_release);
+  }
+  epoch_.fetch_add(1, std::memory_order_release);
+  epoch_.notify_one();
+}
+
+Job* JobSystem::Find() {
+  bool worker = tSystem == this;
+  if (worker) {
+    if (Job* job = deques_[tWorker]->Pop()) return job;
+  }
+
+  if (injectedCount_.load(std::memory_order_acquire) > 0) {
+    std::lock_guard lock(injectMutex_);
+    if (!injected_.empty()) {
+      Job* job = injected_.front();
+      injected_.pop_front();
+      injectedCount_.fetch_sub(1, std::memory_order_relaxed);
+      return job;
+    }
+  }
+
+  // Start stealing at a different victim each time so thieves spread out.
+  static thread_local uint32_t seed = 0x9E3779B9u;
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  size_t victims = deques_.size();
+  for (size_t n = 0; n < victims; n++) {
+    size_t victim = (seed + n) % victims;
+    if (worker && victim == tWorker) continue;
+    if (Job* job = deques_[victim]->Steal()) return job;
+  }
+  return nullptr;
+}
+
+void JobSystem::Execute(Job* job) {
+  job->fn();
+  Finish(job->counter);
+  delete job;
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+  if (!counter) return;
+
+  std::vector<Job*> ready;
+  {
+    std::lock_guard lock(counter->mutex_);
+    if (counter->value_.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    ready.swap(counter->dependents_);
+    counter->value_.notify_all();
+  }
+  for (Job* job : ready) Push(job);
+}
+
+JobSystem& Jobs() {
+  static JobSystem jobs;
+  return jobs;
+}
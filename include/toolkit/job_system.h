@@ -0,0 +1,98 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Job;
+
+// Number of outstanding jobs. A job run with a counter raises it while
+// queued and lowers it once finished; jobs may be held back until a
+// counter reaches zero, and threads can wait for it.
+class JobCounter {
+ public:
+  JobCounter() = default;
+
+  JobCounter(const JobCounter&) = delete;
+  JobCounter& operator=(const JobCounter&) = delete;
+
+  // True once every job run with this counter has finished. The counter
+  // may be destroyed as soon as this returns true.
+  bool Done() const;
+
+ private:
+  friend class JobSystem;
+
+  std::atomic<int> value_ = 0;
+  // Guards the dependents and the final decrement, so a waiter that sees
+  // zero knows the finishing thread is done with the counter.
+  mutable std::mutex mutex_;
+  // Jobs waiting for this counter to reach zero.
+  std::vector<Job*> dependents_;
+};
+
+// A work-stealing job scheduler.
+//
+// Each worker thread owns a Chase-Lev deque: it pushes and pops jobs at
+// the bottom without locking, and idle workers steal from the top of
+// others. Jobs submitted from threads that are not workers go through a
+// shared queue. Idle workers sleep until new work is pushed.
+class JobSystem {
+ public:
+  // Starts `workers` threads; by default one per core besides the caller.
+  explicit JobSystem(unsigned int workers = DefaultWorkerCount());
+
+  // Finishes queued jobs and joins the workers.
+  ~JobSystem();
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  // Queues `fn`. If `counter` is given it is raised now and lowered when
+  // `fn` returns. If `after` is given the job is held until it is done.
+  void Run(std::function<void()> fn, JobCounter* counter = nullptr,
+           JobCounter* after = nullptr);
+
+  // Returns once `counter` is done. By default the caller runs queued
+  // jobs meanwhile, so waiting from inside a job cannot deadlock; with
+  // `help` false it just blocks.
+  void Wait(JobCounter& counter, bool help = true);
+
+  // Calls `fn(begin, end)` over consecutive ranges covering [0, count),
+  // each at least `grain` long, as jobs, and helps run them.
+  void ParallelFor(size_t count, size_t grain,
+                   const std::function<void(size_t begin, size_t end)>& fn);
+
+  unsigned int WorkerCount() const { return workers_.size(); }
+
+  static unsigned int DefaultWorkerCount();
+
+ private:
+  class Deque;
+
+  void WorkerLoop(unsigned int index, std::stop_token stop);
+  void Push(Job* job);
+  Job* Find();
+  void Execute(Job* job);
+  void Finish(JobCounter* counter);
+
+  std::vector<std::unique_ptr<Deque>> deques_;
+
+  // Jobs pushed by threads that own no deque.
+  std::mutex injectMutex_;
+  std::deque<Job*> injected_;
+  std::atomic<size_t> injectedCount_ = 0;
+
+  // Bumped on every push so sleeping workers recheck for work.
+  std::atomic<uint32_t> epoch_ = 0;
+
+  std::vector<std::jthread> workers_;
+};
+
+// The process-wide job system, started on first use.
+JobSystem& Jobs();
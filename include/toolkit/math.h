@@ -0,0 +1,164 @@
+#pragma once
+#include <cmath>
+
+struct Vec3 {
+  float x, y, z;
+};
+
+inline Vec3 operator-(Vec3 a, Vec3 b) {
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+inline float Dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+inline Vec3 Cross(Vec3 a, Vec3 b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+inline Vec3 Normalize(Vec3 v) {
+  float length = std::sqrt(Dot(v, v));
+  return {v.x / length, v.y / length, v.z / length};
+}
+
+// 4x4 matrix stored column-major, the way glUniformMatrix4fv expects it
+// with transpose set to GL_FALSE. Element (row, col) is m[col * 4 + row].
+struct Mat4 {
+  float m[16];
+
+  float& operator()(int row, int col) { return m[col * 4 + row]; }
+  float operator()(int row, int col) const { return m[col * 4 + row]; }
+};
+
+inline Mat4 Identity() {
+  return {{1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+}
+
+inline Mat4 operator*(const Mat4& a, const Mat4& b) {
+  Mat4 r;
+  for (int col = 0; col < 4; col++) {
+    for (int row = 0; row < 4; row++) {
+      r(row, col) = a(row, 0) * b(0, col) + a(row, 1) * b(1, col) +
+                    a(row, 2) * b(2, col) + a(row, 3) * b(3, col);
+    }
+  }
+  return r;
+}
+
+inline Mat4 Translate(Vec3 t) {
+  Mat4 r = Identity();
+  r(0, 3) = t.x;
+  r(1, 3) = t.y;
+  r(2, 3) = t.z;
+  return r;
+}
+
+inline Mat4 Scale(Vec3 s) {
+  Mat4 r = Identity();
+  r(0, 0) = s.x;
+  r(1, 1) = s.y;
+  r(2, 2) = s.z;
+  return r;
+}
+
+// Rotation of `radians` around the unit `axis`.
+inline Mat4 Rotate(float radians, Vec3 axis) {
+  float c = std::cos(radians), s = std::sin(radians), t = 1 - c;
+  float x = axis.x, y = axis.y, z = axis.z;
+  Mat4 r = Identity();
+  r(0, 0) = t * x * x + c;
+  r(0, 1) = t * x * y - s * z;
+  r(0, 2) = t * x * z + s * y;
+  r(1, 0) = t * x * y + s * z;
+  r(1, 1) = t * y * y + c;
+  r(1, 2) = t * y * z - s * x;
+  r(2, 0) = t * x * z - s * y;
+  r(2, 1) = t * y * z + s * x;
+  r(2, 2) = t * z * z + c;
+  return r;
+}
+
+// Unit quaternion rotation.
+struct Quat {
+  float x, y, z, w;
+};
+
+inline Quat AxisAngle(float radians, Vec3 axis) {
+  float s = std::sin(radians / 2);
+  return {axis.x * s, axis.y * s, axis.z * s, std::cos(radians / 2)};
+}
+
+// Scales by `s`, then rotates by `r`, then translates by `t`, as one
+// matrix without the intermediate products.
+inline Mat4 Compose(Vec3 t, Quat r, Vec3 s) {
+  float xx = r.x * r.x, yy = r.y * r.y, zz = r.z * r.z;
+  float xy = r.x * r.y, xz = r.x * r.z, yz = r.y * r.z;
+  float wx = r.w * r.x, wy = r.w * r.y, wz = r.w * r.z;
+  return {{
+      (1 - 2 * (yy + zz)) * s.x, 2 * (xy + wz) * s.x, 2 * (xz - wy) * s.x, 0,
+      2 * (xy - wz) * s.y, (1 - 2 * (xx + zz)) * s.y, 2 * (yz + wx) * s.y, 0,
+      2 * (xz + wy) * s.z, 2 * (yz - wx) * s.z, (1 - 2 * (xx + yy)) * s.z, 0,
+      t.x, t.y, t.z, 1,
+  }};
+}
+
+// Right-handed perspective projection onto GL's [-1, 1] clip volume.
+inline Mat4 Perspective(float fovy, float aspect, float near, float far) {
+  float f = 1.0f / std::tan(fovy / 2);
+  Mat4 r = {};
+  r(0, 0) = f / aspect;
+  r(1, 1) = f;
+  r(2, 2) = (far + near) / (near - far);
+  r(2, 3) = 2 * far * near / (near - far);
+  r(3, 2) = -1;
+  return r;
+}
+
+inline Mat4 Orthographic(float left, float right, float bottom, float top,
+                         float near, float far) {
+  Mat4 r = Identity();
+  r(0, 0) = 2 / (right - left);
+  r(1, 1) = 2 / (top - bottom);
+  r(2, 2) = -2 / (far - near);
+  r(0, 3) = -(right + left) / (right - left);
+  r(1, 3) = -(top + bottom) / (top - bottom);
+  r(2, 3) = -(far + near) / (far - near);
+  return r;
+}
+
+inline Mat4 LookAt(Vec3 eye, Vec3 center, Vec3 up) {
+  Vec3 f = Normalize(center - eye);
+  Vec3 s = Normalize(Cross(f, up));
+  Vec3 u = Cross(s, f);
+  Mat4 r = Identity();
+  r(0, 0) = s.x;
+  r(0, 1) = s.y;
+  r(0, 2) = s.z;
+  r(1, 0) = u.x;
+  r(1, 1) = u.y;
+  r(1, 2) = u.z;
+  r(2, 0) = -f.x;
+  r(2, 1) = -f.y;
+  r(2, 2) = -f.z;
+  r(0, 3) = -Dot(s, eye);
+  r(1, 3) = -Dot(u, eye);
+  r(2, 3) = Dot(f, eye);
+  return r;
+}
+
+// Extracts the left, right, bottom, top, near and far planes of the
+// frustum `viewProj` maps to the clip volume. Each (a, b, c, d) is
+// normalized and keeps points where a*x + b*y + c*z + d >= 0, the form
+// GpuCuller and FrustumCuller take.
+inline void ExtractFrustumPlanes(const Mat4& viewProj, float planes[6][4]) {
+  for (int i = 0; i < 6; i++) {
+    int axis = i / 2;
+    float sign = i % 2 == 0 ? 1.0f : -1.0f;
+    float n[4];
+    for (int col = 0; col < 4; col++)
+      n[col] = viewProj(3, col) + sign * viewProj(axis, col);
+
+    float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    for (int col = 0; col < 4; col++) planes[i][col] = n[col] / length;
+  }
+}
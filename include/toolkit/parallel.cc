@@ -0,0 +1,8 @@
+#include "parallel.h"
+
+#include "job_system.h"
+
+void ParallelFor(size_t count, size_t grain,
+                 const std::function<void(size_t begin, size_t end)>& fn) {
+  Jobs().ParallelFor(count, grain, fn);
+}
@@ -0,0 +1,10 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+
+// Calls `fn(begin, end)` over consecutive ranges covering [0, count),
+// each at least `grain` long, spread across the machine's cores as jobs
+// on Jobs(). The calling thread works on one of the ranges and helps run
+// the rest, returning once every range is done.
+void ParallelFor(size_t count, size_t grain,
+                 const std::function<void(size_t begin, size_t end)>& fn);
@@ -0,0 +1,32 @@
+#pragma once
+#include "trace.h"
+
+// Names the innermost profiled region on the calling thread so anything
+// reported from inside it, such as GL debug messages, can be attributed
+// to it. Scopes nest and only cost a couple of thread-local stores.
+class ProfileScope {
+ public:
+  explicit ProfileScope(const char* name) : parent_(current_) {
+    current_ = name;
+  }
+  ~ProfileScope() { current_ = parent_; }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+  // Name of the innermost scope on this thread, or null outside any.
+  static const char* Current() { return current_; }
+
+ private:
+  const char* parent_;
+  static inline thread_local const char* current_ = nullptr;
+};
+
+#define PROFILE_SCOPE_CONCAT_(a, b) a##b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_(a, b)
+
+// Opens a ProfileScope that lasts until the end of the enclosing block,
+// and records it as a trace zone.
+#define PROFILE_SCOPE(name)                                        \
+  ProfileScope PROFILE_SCOPE_CONCAT(profileScope, __LINE__)(name); \
+  TRACE_ZONE(name)
@@ -0,0 +1,391 @@
+#include <glad/glad.h>
+
+#include "render_target.h"
+
+#include <algorithm>
+#include <print>
+
+#include "gl_format.h"
+#include "shader.h"
+
+// One triangle covering the screen, positioned from gl_VertexID so it
+// needs no vertex buffer.
+static const char* kSharpenVertexShader = R"(
+#version 330 core
+out vec2 vUv;
+
+void main() {
+  vUv = vec2(gl_VertexID & 1, gl_VertexID >> 1) * 2.0;
+  gl_Position = vec4(vUv * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+// Contrast-adaptive sharpening: subtracts a share of the four neighbours
+// that shrinks where local contrast is already high, so stretched edges
+// regain definition without ringing on hard ones. Samples are clamped to
+// the drawn region, since texels beyond it are stale.
+static const char* kSharpenFragmentShader = R"(
+#version 330 core
+in vec2 vUv;
+out vec4 FragColor;
+
+uniform sampler2D uScene;
+// Drawn region and one texel, in texture coordinates.
+uniform vec2 uUvScale;
+uniform vec2 uTexel;
+uniform float uSharpness;
+
+vec3 Fetch(vec2 uv) {
+  return texture(uScene, clamp(uv, 0.5 * uTexel, uUvScale - 0.5 * uTexel)).rgb;
+}
+
+void main() {
+  vec2 uv = vUv * uUvScale;
+  vec3 c = Fetch(uv);
+  vec3 n = Fetch(uv + vec2(0.0, uTexel.y));
+  vec3 s = Fetch(uv - vec2(0.0, uTexel.y));
+  vec3 e = Fetch(uv + vec2(uTexel.x, 0.0));
+  vec3 w = Fetch(uv - vec2(uTexel.x, 0.0));
+
+  vec3 lo = min(c, min(min(n, s), min(e, w)));
+  vec3 hi = max(c, max(max(n, s), max(e, w)));
+  vec3 amount = sqrt(clamp(min(lo, 1.0 - hi) / max(hi, 1e-4), 0.0, 1.0));
+  vec3 weight = -amount * mix(0.125, 0.2, uSharpness);
+  vec3 color = (c + (n + s + e + w) * weight) / (1.0 + 4.0 * weight);
+  FragColor = vec4(clamp(color, 0.0, 1.0), 1.0);
+}
+)";
+
+RenderTargetPool::RenderTargetPool(size_t idleBudget)
+    : idleBudget_(idleBudget) {}
+
+size_t RenderTargetPool::Bytes(const RenderTargetDesc& desc) {
+  uint64_t texel = GLInternalFormatBytes(desc.colorFormat);
+  if (desc.depthFormat != 0) texel += GLInternalFormatBytes(desc.depthFormat);
+  return uint64_t(desc.width) * desc.height * std::max(desc.samples, 1) *
+         texel;
+}
+
+RenderTarget* RenderTargetPool::Acquire(const RenderTargetDesc& desc) {
+  // Newest first, so the target just recycled is the one handed back.
+  auto idle =
+      std::find_if(idle_.rbegin(), idle_.rend(),
+                   [&](const Idle& i) { return i.target->desc == desc; });
+  if (idle != idle_.rend()) {
+    std::unique_ptr<RenderTarget> target = std::move(idle->target);
+    idle_.erase(std::next(idle).base());
+    stats_.reuses++;
+    stats_.idleBytes -= target->bytes;
+    stats_.liveBytes += target->bytes;
+    return live_.emplace_back(std::move(target)).get();
+  }
+
+  auto target = std::make_unique<RenderTarget>();
+  target->desc = desc;
+  if (!Allocate(target.get())) {
+    Free(std::move(target));
+    return nullptr;
+  }
+  stats_.allocations++;
+  stats_.bytesAllocated += target->bytes;
+  stats_.liveBytes += target->bytes;
+  return live_.emplace_back(std::move(target)).get();
+}
+
+bool RenderTargetPool::Allocate(RenderTarget* target) {
+  const RenderTargetDesc& desc = target->desc;
+  target->bytes = Bytes(desc);
+
+  glGenFramebuffers(1, &target->framebuffer);
+  glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+
+  if (desc.samples == 0) {
+    glGenTextures(1, &target->color);
+    glBindTexture(GL_TEXTURE_2D, target->color);
+    glTexImage2D(GL_TEXTURE_2D, 0, desc.colorFormat, desc.width, desc.height,
+                 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                           GL_TEXTURE_2D, target->color, 0);
+  } else {
+    glGenRenderbuffers(1, &target->color);
+    glBindRenderbuffer(GL_RENDERBUFFER, target->color);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, desc.samples,
+                                     desc.colorFormat, desc.width,
+                                     desc.height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, target->color);
+  }
+
+  if (desc.depthFormat != 0) {
+    glGenRenderbuffers(1, &target->depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, target->depth);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, desc.samples,
+                                     desc.depthFormat, desc.width,
+                                     desc.height);
+    GLenum attachment = desc.depthFormat == GL_DEPTH24_STENCIL8 ||
+                                desc.depthFormat == GL_DEPTH32F_STENCIL8
+                            ? GL_DEPTH_STENCIL_ATTACHMENT
+                            : GL_DEPTH_ATTACHMENT;
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER,
+                              target->depth);
+  }
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+  GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    std::println(stderr,
+                 "Render target {}x{} with {} samples incomplete: {:#x}",
+                 desc.width, desc.height, desc.samples, status);
+    return false;
+  }
+  return true;
+}
+
+void RenderTargetPool::Free(std::unique_ptr<RenderTarget> target) {
+  glDeleteFramebuffers(1, &target->framebuffer);
+  if (target->desc.samples == 0)
+    glDeleteTextures(1, &target->color);
+  else
+    glDeleteRenderbuffers(1, &target->color);
+  glDeleteRenderbuffers(1, &target->depth);
+}
+
+void RenderTargetPool::Recycle(RenderTarget* target) {
+  if (target == nullptr) return;
+  auto live = std::ranges::find_if(
+      live_, [&](const auto& t) { return t.get() == target; });
+  if (live == live_.end()) {
+    std::println(stderr, "Recycled a render target the pool does not own.");
+    return;
+  }
+  stats_.liveBytes -= target->bytes;
+  stats_.idleBytes += target->bytes;
+  idle_.push_back({std::move(*live), frame_});
+  live_.erase(live);
+}
+
+void RenderTargetPool::EndFrame() {
+  frame_++;
+  // Idle targets are kept oldest first, so both passes evict from the
+  // front.
+  auto evict = [&](auto keep) {
+    auto first = idle_.begin();
+    while (first != idle_.end() && !keep(*first)) {
+      stats_.frees++;
+      stats_.bytesFreed += first->target->bytes;
+      stats_.idleBytes -= first->target->bytes;
+      Free(std::move(first->target));
+      ++first;
+    }
+    idle_.erase(idle_.begin(), first);
+  };
+  evict([&](const Idle& i) {
+    return frame_ - i.lastUsedFrame <= kMaxIdleFrames;
+  });
+  size_t over = stats_.idleBytes > idleBudget_ ? stats_.idleBytes - idleBudget_
+                                               : 0;
+  evict([&](const Idle& i) {
+    if (over == 0) return true;
+    over -= std::min(over, i.target->bytes);
+    return false;
+  });
+}
+
+void RenderTargetPool::Release() {
+  for (auto& target : live_) {
+    stats_.frees++;
+    stats_.bytesFreed += target->bytes;
+    Free(std::move(target));
+  }
+  for (Idle& idle : idle_) {
+    stats_.frees++;
+    stats_.bytesFreed += idle.target->bytes;
+    Free(std::move(idle.target));
+  }
+  live_.clear();
+  idle_.clear();
+  stats_.liveBytes = 0;
+  stats_.idleBytes = 0;
+}
+
+SceneTarget::SceneTarget(RenderTargetPool& pool, const RenderTargetDesc& desc,
+                         double settleSeconds)
+    : pool_(pool), desc_(desc), settleSeconds_(settleSeconds) {}
+
+void SceneTarget::Resize(int width, int height, double now) {
+  if (width == windowWidth_ && height == windowHeight_) return;
+  windowWidth_ = width;
+  windowHeight_ = height;
+  lastResize_ = now;
+  if (target_ == nullptr) return;
+
+  if (!resizing_) {
+    resizing_ = true;
+    current_ = {};
+    resizeStart_ = now;
+    allocationsAtStart_ = pool_.Stats().allocations;
+    bytesAtStart_ = pool_.Stats().bytesAllocated;
+  }
+  RenderTargetDesc desc = desc_;
+  desc.width = width;
+  desc.height = height;
+  current_.events++;
+  current_.naiveBytes += RenderTargetPool::Bytes(desc);
+}
+
+void SceneTarget::SetRenderScale(float scale) {
+  renderScale_ = std::clamp(scale, 0.25f, 1.0f);
+}
+
+void SceneTarget::SetSharpness(float sharpness) {
+  sharpness_ = std::clamp(sharpness, 0.0f, 1.0f);
+}
+
+RenderTarget* SceneTarget::Begin(double now) {
+  // A minimized window reports 0x0; keep drawing at the old size.
+  bool visible = windowWidth_ > 0 && windowHeight_ > 0;
+  bool stale = target_ == nullptr || target_->desc.width != windowWidth_ ||
+               target_->desc.height != windowHeight_;
+  bool settled = target_ == nullptr || now - lastResize_ >= settleSeconds_;
+  if (visible && stale && settled) {
+    pool_.Recycle(target_);
+    pool_.Recycle(resolve_);
+    resolve_ = nullptr;
+    desc_.width = windowWidth_;
+    desc_.height = windowHeight_;
+    target_ = pool_.Acquire(desc_);
+  }
+
+  if (resizing_ && settled) {
+    resizing_ = false;
+    current_.seconds = now - resizeStart_;
+    current_.allocations = pool_.Stats().allocations - allocationsAtStart_;
+    current_.bytesChurned = pool_.Stats().bytesAllocated - bytesAtStart_;
+    report_ = current_;
+    reportReady_ = true;
+  }
+
+  if (target_ == nullptr) return nullptr;
+  renderWidth_ = std::max(1, int(target_->desc.width * renderScale_ + 0.5f));
+  renderHeight_ =
+      std::max(1, int(target_->desc.height * renderScale_ + 0.5f));
+  glBindFramebuffer(GL_FRAMEBUFFER, target_->framebuffer);
+  glViewport(0, 0, renderWidth_, renderHeight_);
+  return target_;
+}
+
+void SceneTarget::Present() {
+  if (target_ == nullptr) return;
+  int width = renderWidth_, height = renderHeight_;
+  bool scaled = width != windowWidth_ || height != windowHeight_;
+  bool sharpen = scaled && sharpness_ > 0;
+
+  const RenderTarget* source = target_;
+  if (scaled && target_->desc.samples > 0) {
+    if (resolve_ == nullptr) {
+      RenderTargetDesc desc = target_->desc;
+      desc.depthFormat = 0;
+      desc.samples = 0;
+      resolve_ = pool_.Acquire(desc);
+      if (resolve_ == nullptr) return;
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, target_->framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, resolve_->framebuffer);
+    glBlitFramebuffer(0, 0, width, height, 0, 0, width, height,
+                      GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    source = resolve_;
+  }
+
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  glViewport(0, 0, windowWidth_, windowHeight_);
+  if (sharpen && Sharpen(*source)) return;
+
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, source->framebuffer);
+  glBlitFramebuffer(0, 0, width, height, 0, 0, windowWidth_, windowHeight_,
+                    GL_COLOR_BUFFER_BIT, scaled ? GL_LINEAR : GL_NEAREST);
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+bool SceneTarget::Sharpen(const RenderTarget& source) {
+  if (!sharpenBuilt_) {
+    sharpenBuilt_ = true;
+    sharpenProgram_ =
+        CompileShaderProgram(kSharpenVertexShader, kSharpenFragmentShader);
+    if (sharpenProgram_ == 0) {
+      std::println(stderr, "Sharpening disabled; upscaling with a blit.");
+      return false;
+    }
+    glUseProgram(sharpenProgram_);
+    glUniform1i(glGetUniformLocation(sharpenProgram_, "uScene"), 0);
+    uvScaleLocation_ = glGetUniformLocation(sharpenProgram_, "uUvScale");
+    texelLocation_ = glGetUniformLocation(sharpenProgram_, "uTexel");
+    sharpnessLocation_ = glGetUniformLocation(sharpenProgram_, "uSharpness");
+    // Core profiles need a vertex array bound even with no attributes.
+    glGenVertexArrays(1, &sharpenVao_);
+  }
+  if (sharpenProgram_ == 0) return false;
+
+  // The pass runs between a sample's frames, so whatever state it
+  // changes is put back for the next one.
+  GLint program, vao, texture, activeTexture, polygonMode[2];
+  glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vao);
+  glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+  glActiveTexture(GL_TEXTURE0);
+  glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture);
+  glGetIntegerv(GL_POLYGON_MODE, polygonMode);
+  GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+  GLboolean blend = glIsEnabled(GL_BLEND);
+  GLboolean cullFace = glIsEnabled(GL_CULL_FACE);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  glDisable(GL_CULL_FACE);
+  glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+
+  float texWidth = source.desc.width, texHeight = source.desc.height;
+  glUseProgram(sharpenProgram_);
+  glUniform2f(uvScaleLocation_, renderWidth_ / texWidth,
+              renderHeight_ / texHeight);
+  glUniform2f(texelLocation_, 1.0f / texWidth, 1.0f / texHeight);
+  glUniform1f(sharpnessLocation_, sharpness_);
+  glBindTexture(GL_TEXTURE_2D, source.color);
+  glBindVertexArray(sharpenVao_);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+
+  glBindVertexArray(vao);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glActiveTexture(activeTexture);
+  glUseProgram(program);
+  glPolygonMode(GL_FRONT_AND_BACK, polygonMode[0]);
+  if (depthTest) glEnable(GL_DEPTH_TEST);
+  if (blend) glEnable(GL_BLEND);
+  if (cullFace) glEnable(GL_CULL_FACE);
+  return true;
+}
+
+bool SceneTarget::TakeResizeReport(ResizeReport* report) {
+  if (!reportReady_) return false;
+  *report = report_;
+  reportReady_ = false;
+  return true;
+}
+
+void SceneTarget::Release() {
+  pool_.Recycle(target_);
+  pool_.Recycle(resolve_);
+  target_ = nullptr;
+  resolve_ = nullptr;
+  resizing_ = false;
+
+  glDeleteProgram(sharpenProgram_);
+  glDeleteVertexArrays(1, &sharpenVao_);
+  sharpenProgram_ = 0;
+  sharpenVao_ = 0;
+  sharpenBuilt_ = false;
+}
@@ -0,0 +1,189 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Size and formats of an offscreen framebuffer. `samples` of 0 gives a
+// color texture that can be sampled; more gives multisampled
+// renderbuffers that have to be resolved with a blit.
+struct RenderTargetDesc {
+  int width = 0;
+  int height = 0;
+  unsigned int colorFormat = 0;
+  // 0 for no depth attachment.
+  unsigned int depthFormat = 0;
+  int samples = 0;
+
+  bool operator==(const RenderTargetDesc&) const = default;
+};
+
+struct RenderTarget {
+  RenderTargetDesc desc;
+  unsigned int framebuffer = 0;
+  // A texture when desc.samples is 0, a renderbuffer otherwise.
+  unsigned int color = 0;
+  unsigned int depth = 0;
+  size_t bytes = 0;
+};
+
+struct RenderTargetStats {
+  uint64_t allocations = 0;
+  uint64_t reuses = 0;
+  uint64_t frees = 0;
+  uint64_t bytesAllocated = 0;
+  uint64_t bytesFreed = 0;
+  // Held by callers and idle in the pool.
+  size_t liveBytes = 0;
+  size_t idleBytes = 0;
+};
+
+// Offscreen render targets keyed by size, formats and sample count.
+//
+// Acquire() hands out an idle target with exactly the requested
+// description before allocating a new one, so targets that come and go
+// every frame, or flip between a few sizes, stop costing allocations.
+// Idle targets are freed after going unused for a few frames, or sooner
+// while the idle total is over budget.
+class RenderTargetPool {
+ public:
+  explicit RenderTargetPool(size_t idleBudget = 256 << 20);
+
+  RenderTargetPool(const RenderTargetPool&) = delete;
+  RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+  // Returns a complete target matching `desc`, or null if the driver
+  // rejects it.
+  RenderTarget* Acquire(const RenderTargetDesc& desc);
+
+  // Returns `target` to the pool. The GPU may still be rendering to it;
+  // later commands that reuse it are ordered after that work.
+  void Recycle(RenderTarget* target);
+
+  // Frees idle targets unused for kMaxIdleFrames, then the least
+  // recently used ones while over budget. Call once per frame.
+  void EndFrame();
+
+  // Deletes every target. Must be called while the context is still
+  // current.
+  void Release();
+
+  const RenderTargetStats& Stats() const { return stats_; }
+
+  // Bytes a target with `desc` takes.
+  static size_t Bytes(const RenderTargetDesc& desc);
+
+ private:
+  static constexpr uint64_t kMaxIdleFrames = 60;
+
+  struct Idle {
+    std::unique_ptr<RenderTarget> target;
+    uint64_t lastUsedFrame;
+  };
+
+  bool Allocate(RenderTarget* target);
+  void Free(std::unique_ptr<RenderTarget> target);
+
+  size_t idleBudget_;
+  uint64_t frame_ = 0;
+  std::vector<std::unique_ptr<RenderTarget>> live_;
+  // Oldest first.
+  std::vector<Idle> idle_;
+  RenderTargetStats stats_;
+};
+
+// What one resize cost, from the first size change until the target
+// settled at the final size.
+struct ResizeReport {
+  int events = 0;
+  double seconds = 0;
+  uint64_t allocations = 0;
+  uint64_t bytesChurned = 0;
+  // What reallocating on every event would have churned.
+  uint64_t naiveBytes = 0;
+};
+
+// The offscreen target a window's frames render into, following the
+// window size without reallocating on every framebuffer-size event.
+//
+// Resize() only records the new size. Until no new size has arrived for
+// the settle time, Begin() keeps returning the target at its old size
+// and Present() stretches it over the window with a linear blit, so a
+// drag across dozens of sizes costs one allocation at the end.
+//
+// With a render scale below 1 frames are drawn into the bottom-left part
+// of the target and upscaled on Present(), so the scale can change every
+// frame without reallocating. The upscale is a linear blit, or with a
+// sharpness above 0 a pass that sharpens edges the stretch blurred.
+class SceneTarget {
+ public:
+  // `desc` gives the formats and sample count; its size is ignored.
+  SceneTarget(RenderTargetPool& pool, const RenderTargetDesc& desc,
+              double settleSeconds = 0.2);
+
+  SceneTarget(const SceneTarget&) = delete;
+  SceneTarget& operator=(const SceneTarget&) = delete;
+
+  // Records the window's framebuffer size at time `now`, in seconds.
+  void Resize(int width, int height, double now);
+
+  // Fraction of the target's width and height drawn from the next
+  // Begin() on, clamped to [0.25, 1].
+  void SetRenderScale(float scale);
+
+  // Strength of the sharpening applied when upscaling, 0 to 1. 0 uses a
+  // plain linear blit.
+  void SetSharpness(float sharpness);
+
+  // Size frames are drawn at since the last Begin().
+  int RenderWidth() const { return renderWidth_; }
+  int RenderHeight() const { return renderHeight_; }
+
+  // Binds the target for this frame's rendering and sets the viewport
+  // to its scaled size, reallocating first if the size has settled.
+  RenderTarget* Begin(double now);
+
+  // Blits the frame to the default framebuffer, resolving multisampling
+  // and scaling to the window size as needed.
+  void Present();
+
+  // Sets `*report` and returns true once per settled resize.
+  bool TakeResizeReport(ResizeReport* report);
+
+  // Returns the targets to the pool and deletes the sharpening program.
+  void Release();
+
+ private:
+  // Draws the bottom-left RenderWidth() x RenderHeight() texels of
+  // `source`'s color texture over the default framebuffer, sharpened.
+  // Returns false if the program could not be built, so the caller can
+  // blit instead.
+  bool Sharpen(const RenderTarget& source);
+
+  RenderTargetPool& pool_;
+  RenderTargetDesc desc_;
+  double settleSeconds_;
+
+  RenderTarget* target_ = nullptr;
+  // Single-sampled copy a multisampled target resolves into before a
+  // scaled blit, which GL cannot do from multisampled storage.
+  RenderTarget* resolve_ = nullptr;
+  int windowWidth_ = 0, windowHeight_ = 0;
+  double lastResize_ = 0;
+
+  float renderScale_ = 1;
+  int renderWidth_ = 0, renderHeight_ = 0;
+  float sharpness_ = 0;
+  // The program is built on first use and stays 0 if that fails.
+  bool sharpenBuilt_ = false;
+  unsigned int sharpenProgram_ = 0;
+  unsigned int sharpenVao_ = 0;
+  int uvScaleLocation_ = -1, texelLocation_ = -1, sharpnessLocation_ = -1;
+
+  bool resizing_ = false;
+  ResizeReport current_;
+  double resizeStart_ = 0;
+  uint64_t allocationsAtStart_ = 0, bytesAtStart_ = 0;
+  bool reportReady_ = false;
+  ResizeReport report_;
+};
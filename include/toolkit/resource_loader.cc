@@ -0,0 +1,188 @@
+#include <glad/glad.h>
+
+#include "resource_loader.h"
+
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <print>
+
+#include "trace.h"
+
+ResourceLoader::~ResourceLoader() {
+  if (Running())
+    std::println(stderr, "ResourceLoader destroyed without Stop().");
+}
+
+bool ResourceLoader::Start(GLFWwindow* shared) {
+  if (Running()) return true;
+
+  // Context version and profile hints are still those of the shared
+  // window.
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  window_ = glfwCreateWindow(1, 1, "Resource Loader", NULL, shared);
+  glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+  if (window_ == NULL) {
+    std::println(stderr, "Failed to create the resource loader context.");
+    return false;
+  }
+
+  thread_ = std::jthread([this](std::stop_token stop) { Run(stop); });
+  return true;
+}
+
+void ResourceLoader::Stop() {
+  if (!Running()) return;
+  thread_.request_stop();
+  cv_.notify_all();
+  thread_.join();
+  glfwDestroyWindow(window_);
+  window_ = nullptr;
+
+  // Objects are shared, so the render context can delete what was never
+  // adopted.
+  for (auto& [id, finished] : finished_) {
+    glDeleteSync((GLsync)finished.fence);
+    if (finished.texture) {
+      glDeleteTextures(1, &finished.name);
+    } else {
+      glDeleteBuffers(1, &finished.name);
+    }
+  }
+  finished_.clear();
+  queue_.clear();
+}
+
+UploadId ResourceLoader::UploadBuffer(std::vector<unsigned char> data,
+                                      unsigned int usage) {
+  Request request;
+  request.usage = usage;
+  request.data = std::move(data);
+  return Queue(std::move(request));
+}
+
+UploadId ResourceLoader::UploadTexture(TextureUpload upload) {
+  Request request;
+  request.texture = true;
+  request.image = std::move(upload);
+  return Queue(std::move(request));
+}
+
+UploadId ResourceLoader::Queue(Request request) {
+  std::lock_guard lock(mu_);
+  request.id = nextId_++;
+  UploadId id = request.id;
+  queue_.push_back(std::move(request));
+  cv_.notify_one();
+  return id;
+}
+
+bool ResourceLoader::Adopt(UploadId id, unsigned int* name) {
+  Finished finished;
+  {
+    std::lock_guard lock(mu_);
+    auto it = finished_.find(id);
+    if (it == finished_.end()) return false;
+    finished = it->second;
+  }
+
+  // The loader flushed after fencing, so polling cannot miss the signal.
+  GLenum status = glClientWaitSync((GLsync)finished.fence, 0, 0);
+  if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+    return false;
+  glDeleteSync((GLsync)finished.fence);
+
+  std::lock_guard lock(mu_);
+  finished_.erase(id);
+  *name = finished.name;
+  return true;
+}
+
+size_t ResourceLoader::Pending() const {
+  std::lock_guard lock(mu_);
+  return queue_.size() + inProgress_ + finished_.size();
+}
+
+uint64_t ResourceLoader::BytesUploaded() const {
+  std::lock_guard lock(mu_);
+  return bytesUploaded_;
+}
+
+void ResourceLoader::Run(std::stop_token stop) {
+  glfwMakeContextCurrent(window_);
+  SetTraceThreadName("Resource Loader");
+
+  while (true) {
+    Request request;
+    {
+      std::unique_lock lock(mu_);
+      if (!cv_.wait(lock, stop, [this] { return !queue_.empty(); })) break;
+      request = std::move(queue_.front());
+      queue_.pop_front();
+      inProgress_++;
+    }
+
+    Finished finished = Upload(request);
+
+    std::lock_guard lock(mu_);
+    inProgress_--;
+    finished_[request.id] = finished;
+  }
+
+  glfwMakeContextCurrent(NULL);
+}
+
+ResourceLoader::Finished ResourceLoader::Upload(Request& request) {
+  TRACE_ZONE("Upload");
+  Finished finished = {.texture = request.texture};
+  size_t bytes = 0;
+
+  if (request.texture) {
+    const TextureUpload& image = request.image;
+    glGenTextures(1, &finished.name);
+    glBindTexture(GL_TEXTURE_2D, finished.name);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, image.internalFormat, image.width,
+                 image.height, 0, image.format, image.type,
+                 image.pixels.data());
+    if (image.mipmaps) {
+      glGenerateMipmap(GL_TEXTURE_2D);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                      GL_LINEAR_MIPMAP_LINEAR);
+    } else {
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    bytes = image.pixels.size();
+  } else {
+    // GL_COPY_WRITE_BUFFER leaves every binding the render thread could
+    // care about alone, though bindings are per context anyway.
+    glGenBuffers(1, &finished.name);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, finished.name);
+    glBufferData(GL_COPY_WRITE_BUFFER, request.data.size(), NULL,
+                 request.usage);
+    for (size_t offset = 0; offset < request.data.size();
+         offset += kChunkBytes) {
+      size_t size = std::min(kChunkBytes, request.data.size() - offset);
+      glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size,
+                      request.data.data() + offset);
+      {
+        std::lock_guard lock(mu_);
+        bytesUploaded_ += size;
+      }
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  }
+
+  finished.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  // Without a flush the fence might never reach the GPU, and the render
+  // thread's poll would never see it signal.
+  glFlush();
+
+  // Copied by GL, so the CPU copy can go right away.
+  request.data = {};
+  request.image.pixels = {};
+  std::lock_guard lock(mu_);
+  bytesUploaded_ += bytes;
+  return finished;
+}
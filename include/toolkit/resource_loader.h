@@ -0,0 +1,110 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct GLFWwindow;
+
+// Identifies an upload queued on a ResourceLoader. 0 is never valid.
+using UploadId = uint64_t;
+
+struct TextureUpload {
+  int width = 0;
+  int height = 0;
+  unsigned int internalFormat = 0;
+  unsigned int format = 0;
+  unsigned int type = 0;
+  // Tightly packed rows of the base level.
+  std::vector<unsigned char> pixels;
+  bool mipmaps = true;
+};
+
+// Uploads buffers and textures on a loader thread with its own GL
+// context, so the render thread never waits on the copies.
+//
+// The loader's context shares objects with the render thread's. Each
+// upload is followed by a fence and a flush there, and the render thread
+// adopts the object with Adopt(), which checks the fence without waiting
+// and hands the name over only once the GPU has the data. Until then
+// the object is invisible to the render thread, so a frame never draws
+// from a half-written resource.
+//
+// Large buffers are written in chunks so a single upload does not hold
+// the driver for long and the data is freed as soon as it is copied.
+class ResourceLoader {
+ public:
+  ResourceLoader() = default;
+  ~ResourceLoader();
+
+  ResourceLoader(const ResourceLoader&) = delete;
+  ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+  // Creates a hidden window whose context shares objects with `shared`'s
+  // and starts the loader thread on it. Call on the main thread, which
+  // GLFW requires for window creation. Returns false if the context
+  // cannot be created.
+  bool Start(GLFWwindow* shared);
+
+  // Stops the loader thread and destroys its context, deleting anything
+  // uploaded but not adopted. Call on the main thread with the render
+  // context current.
+  void Stop();
+
+  bool Running() const { return window_ != nullptr; }
+
+  // Queues `data` to become a buffer created with `usage`.
+  UploadId UploadBuffer(std::vector<unsigned char> data, unsigned int usage);
+
+  // Queues a 2D texture, with its mip chain generated if requested.
+  UploadId UploadTexture(TextureUpload upload);
+
+  // Sets `*name` and returns true once upload `id` is on the GPU; the
+  // object then belongs to the caller. Never waits. Returns false while
+  // the upload is queued, in progress or in flight.
+  bool Adopt(UploadId id, unsigned int* name);
+
+  // Uploads queued or in flight.
+  size_t Pending() const;
+
+  // Bytes handed to GL by the loader thread so far.
+  uint64_t BytesUploaded() const;
+
+ private:
+  struct Request {
+    UploadId id = 0;
+    bool texture = false;
+    unsigned int usage = 0;
+    std::vector<unsigned char> data;
+    TextureUpload image;
+  };
+
+  struct Finished {
+    bool texture = false;
+    unsigned int name = 0;
+    void* fence = nullptr;
+  };
+
+  // Bytes written per glBufferSubData call.
+  static constexpr size_t kChunkBytes = 4 << 20;
+
+  UploadId Queue(Request request);
+  void Run(std::stop_token stop);
+  Finished Upload(Request& request);
+
+  GLFWwindow* window_ = nullptr;
+  UploadId nextId_ = 1;
+
+  mutable std::mutex mu_;
+  std::condition_variable_any cv_;
+  std::deque<Request> queue_;
+  // Uploads done on the loader thread, waiting for Adopt().
+  std::unordered_map<UploadId, Finished> finished_;
+  size_t inProgress_ = 0;
+  uint64_t bytesUploaded_ = 0;
+  std::jthread thread_;
+};
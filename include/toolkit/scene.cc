@@ -0,0 +1,191 @@
+#include <glad/glad.h>
+
+#include "scene.h"
+
+#include <algorithm>
+
+#include "parallel.h"
+
+// Entities per worker range when updating a level.
+constexpr size_t kLevelGrain = 4096;
+
+EntityId Scene::Create(EntityId parent) {
+  EntityId id;
+  if (!freeIds_.empty()) {
+    id = freeIds_.back();
+    freeIds_.pop_back();
+  } else {
+    id = indices_.size();
+    indices_.push_back(kNoIndex);
+  }
+
+  uint32_t parentIndex = parent == kNoEntity ? kNoIndex : indices_[parent];
+  uint32_t depth = parentIndex == kNoIndex ? 0 : depths_[parentIndex] + 1;
+
+  indices_[id] = ids_.size();
+  ids_.push_back(id);
+  positions_.push_back({0, 0, 0});
+  rotations_.push_back({0, 0, 0, 1});
+  scales_.push_back({1, 1, 1});
+  parents_.push_back(parentIndex);
+  depths_.push_back(depth);
+  renderHandles_.push_back(0);
+  worlds_.push_back(Identity());
+  localDirty_.push_back(1);
+  worldChanged_.push_back(0);
+  destroyed_.push_back(0);
+
+  layoutStale_ = true;
+  return id;
+}
+
+void Scene::Destroy(EntityId id) {
+  destroyed_[indices_[id]] = 1;
+  layoutStale_ = true;
+}
+
+void Scene::SetPosition(EntityId id, Vec3 position) {
+  uint32_t i = indices_[id];
+  positions_[i] = position;
+  localDirty_[i] = 1;
+}
+
+void Scene::SetRotation(EntityId id, Quat rotation) {
+  uint32_t i = indices_[id];
+  rotations_[i] = rotation;
+  localDirty_[i] = 1;
+}
+
+void Scene::SetScale(EntityId id, Vec3 scale) {
+  uint32_t i = indices_[id];
+  scales_[i] = scale;
+  localDirty_[i] = 1;
+}
+
+void Scene::SetRenderHandle(EntityId id, uint32_t handle) {
+  renderHandles_[indices_[id]] = handle;
+}
+
+void Scene::Update() {
+  if (layoutStale_) Rebuild();
+
+  for (size_t level = 0; level + 1 < levels_.size(); level++) {
+    ParallelFor(levels_[level + 1] - levels_[level], kLevelGrain,
+                [&](size_t begin, size_t end) {
+                  UpdateLevel(levels_[level] + begin, levels_[level] + end);
+                });
+  }
+
+  auto first = std::ranges::find(worldChanged_, 1);
+  if (first == worldChanged_.end()) return;
+  auto last = std::ranges::find(worldChanged_.rbegin(), worldChanged_.rend(),
+                                1);
+  size_t begin = first - worldChanged_.begin();
+  size_t end = worldChanged_.rend() - last;
+  if (uploadBegin_ == uploadEnd_) {
+    uploadBegin_ = begin;
+    uploadEnd_ = end;
+  } else {
+    uploadBegin_ = std::min(uploadBegin_, begin);
+    uploadEnd_ = std::max(uploadEnd_, end);
+  }
+}
+
+void Scene::UpdateLevel(size_t begin, size_t end) {
+  for (size_t i = begin; i < end; i++) {
+    uint32_t parent = parents_[i];
+    // Parents sit in an earlier level, so their flags are final here.
+    bool changed =
+        localDirty_[i] || (parent != kNoIndex && worldChanged_[parent]);
+    worldChanged_[i] = changed;
+    if (!changed) continue;
+
+    Mat4 local = Compose(positions_[i], rotations_[i], scales_[i]);
+    worlds_[i] = parent == kNoIndex ? local : worlds_[parent] * local;
+    localDirty_[i] = 0;
+  }
+}
+
+void Scene::UploadWorldMatrices(unsigned int target, unsigned int buffer) {
+  glBindBuffer(target, buffer);
+  if (uploadAll_) {
+    glBufferData(target, worlds_.size() * sizeof(Mat4), worlds_.data(),
+                 GL_DYNAMIC_DRAW);
+  } else if (uploadBegin_ < uploadEnd_) {
+    glBufferSubData(target, uploadBegin_ * sizeof(Mat4),
+                    (uploadEnd_ - uploadBegin_) * sizeof(Mat4),
+                    worlds_.data() + uploadBegin_);
+  }
+  glBindBuffer(target, 0);
+
+  uploadAll_ = false;
+  uploadBegin_ = uploadEnd_ = 0;
+}
+
+// Drops destroyed entities and their descendants, and re-sorts the rest
+// by depth, keeping creation order within each level.
+void Scene::Rebuild() {
+  size_t count = ids_.size();
+
+  // A child may have been created before a destroyed parent's flag was
+  // set, so deadness is propagated from the roots down: order by depth
+  // first, then a child is dead if its parent is.
+  uint32_t maxDepth = 0;
+  for (uint32_t depth : depths_) maxDepth = std::max(maxDepth, depth);
+  std::vector<size_t> starts(maxDepth + 2, 0);
+  for (uint32_t depth : depths_) starts[depth + 1]++;
+  for (size_t d = 1; d < starts.size(); d++) starts[d] += starts[d - 1];
+
+  std::vector<uint32_t> order(count);
+  std::vector<size_t> cursor(starts.begin(), starts.end() - 1);
+  for (size_t i = 0; i < count; i++) order[cursor[depths_[i]]++] = i;
+
+  for (uint32_t i : order) {
+    if (parents_[i] != kNoIndex && destroyed_[parents_[i]]) destroyed_[i] = 1;
+  }
+
+  // Old storage index to new, kNoIndex for dropped entities.
+  std::vector<uint32_t> remap(count, kNoIndex);
+  uint32_t kept = 0;
+  for (uint32_t i : order) {
+    if (destroyed_[i]) {
+      indices_[ids_[i]] = kNoIndex;
+      freeIds_.push_back(ids_[i]);
+    } else {
+      remap[i] = kept++;
+    }
+  }
+
+  auto permute = [&](auto& array) {
+    std::remove_reference_t<decltype(array)> sorted(kept);
+    for (size_t i = 0; i < count; i++) {
+      if (remap[i] != kNoIndex) sorted[remap[i]] = array[i];
+    }
+    array.swap(sorted);
+  };
+  permute(positions_);
+  permute(rotations_);
+  permute(scales_);
+  permute(parents_);
+  permute(depths_);
+  permute(renderHandles_);
+  permute(worlds_);
+  permute(localDirty_);
+  permute(ids_);
+  worldChanged_.assign(kept, 0);
+  destroyed_.assign(kept, 0);
+
+  for (uint32_t& parent : parents_) {
+    if (parent != kNoIndex) parent = remap[parent];
+  }
+  for (uint32_t i = 0; i < kept; i++) indices_[ids_[i]] = i;
+
+  levels_.clear();
+  for (uint32_t i = 0; i < kept; i++) {
+    if (i == 0 || depths_[i] != depths_[i - 1]) levels_.push_back(i);
+  }
+  levels_.push_back(kept);
+
+  layoutStale_ = false;
+  uploadAll_ = true;
+}
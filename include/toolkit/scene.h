@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "math.h"
+
+// Stable name for an entity in a Scene. Ids of destroyed entities are
+// reused once the next Update() has run.
+using EntityId = uint32_t;
+constexpr EntityId kNoEntity = UINT32_MAX;
+
+// Transforms, hierarchy and render handles for many entities, kept as
+// structure-of-arrays.
+//
+// Entities are stored sorted by depth in the hierarchy, so every parent
+// comes before its children and each depth is one contiguous level.
+// Update() computes world matrices level by level, spreading each level
+// across worker threads, and only recomputes entities whose local
+// transform or an ancestor's changed. World matrices and render handles
+// sit in the same order, so they can be copied straight into instance or
+// uniform buffers.
+//
+// Creating and destroying entities only marks the layout stale; it is
+// rebuilt once, at the start of the next Update().
+class Scene {
+ public:
+  Scene() = default;
+
+  Scene(const Scene&) = delete;
+  Scene& operator=(const Scene&) = delete;
+
+  // Adds an entity with an identity transform under `parent`, or as a
+  // root for kNoEntity.
+  EntityId Create(EntityId parent = kNoEntity);
+
+  // Removes `id` and all of its descendants at the next Update().
+  void Destroy(EntityId id);
+
+  void SetPosition(EntityId id, Vec3 position);
+  void SetRotation(EntityId id, Quat rotation);
+  void SetScale(EntityId id, Vec3 scale);
+  void SetRenderHandle(EntityId id, uint32_t handle);
+
+  Vec3 Position(EntityId id) const { return positions_[indices_[id]]; }
+  Quat Rotation(EntityId id) const { return rotations_[indices_[id]]; }
+  Vec3 Scale(EntityId id) const { return scales_[indices_[id]]; }
+  uint32_t RenderHandle(EntityId id) const {
+    return renderHandles_[indices_[id]];
+  }
+
+  // World matrix as of the last Update().
+  const Mat4& World(EntityId id) const { return worlds_[indices_[id]]; }
+
+  // Applies pending creations and destructions, then brings every world
+  // matrix up to date.
+  void Update();
+
+  // Copies the world matrices into `buffer` bound to `target`, e.g.
+  // GL_ARRAY_BUFFER for per-instance attributes or GL_UNIFORM_BUFFER.
+  // After a layout change the whole array is uploaded; otherwise only the
+  // span of matrices that changed since the previous upload. Meant to be
+  // used with a single buffer.
+  void UploadWorldMatrices(unsigned int target, unsigned int buffer);
+
+  // Entity count, and arrays in storage order, valid until the next
+  // Update().
+  size_t Count() const { return ids_.size(); }
+  const std::vector<Mat4>& WorldMatrices() const { return worlds_; }
+  const std::vector<uint32_t>& RenderHandles() const { return renderHandles_; }
+  const std::vector<EntityId>& Entities() const { return ids_; }
+
+  // Storage index of `id`, which is also its position in WorldMatrices().
+  uint32_t IndexOf(EntityId id) const { return indices_[id]; }
+
+ private:
+  static constexpr uint32_t kNoIndex = UINT32_MAX;
+
+  void Rebuild();
+  void UpdateLevel(size_t begin, size_t end);
+
+  // Per-entity arrays, all indexed by storage index.
+  std::vector<Vec3> positions_;
+  std::vector<Quat> rotations_;
+  std::vector<Vec3> scales_;
+  std::vector<uint32_t> parents_;
+  std::vector<uint32_t> depths_;
+  std::vector<uint32_t> renderHandles_;
+  std::vector<Mat4> worlds_;
+  // Local transform set since the last Update().
+  std::vector<uint8_t> localDirty_;
+  // World matrix recomputed by the last Update().
+  std::vector<uint8_t> worldChanged_;
+  std::vector<uint8_t> destroyed_;
+  std::vector<EntityId> ids_;
+
+  // Storage index of each id, kNoIndex while free.
+  std::vector<uint32_t> indices_;
+  std::vector<EntityId> freeIds_;
+
+  // Start of each depth level, plus the end of the last one.
+  std::vector<size_t> levels_;
+  bool layoutStale_ = false;
+
+  // Matrices changed since the last upload: everything after a layout
+  // change, otherwise the span [uploadBegin_, uploadEnd_).
+  bool uploadAll_ = true;
+  size_t uploadBegin_ = 0;
+  size_t uploadEnd_ = 0;
+};
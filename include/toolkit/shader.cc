@@ -0,0 +1,88 @@
+#include <glad/glad.h>
+
+#include "shader.h"
+
+#include <fstream>
+#include <print>
+#include <sstream>
+
+#include "capabilities.h"
+
+bool ReadFile(const std::string& path, std::string* out) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return false;
+
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  *out = contents.str();
+  return true;
+}
+
+unsigned int StartShaderCompile(unsigned int type, const char* source) {
+  unsigned int id = glCreateShader(type);
+  glShaderSource(id, 1, &source, NULL);
+  glCompileShader(id);
+  return id;
+}
+
+unsigned int StartProgramLink(unsigned int vShader, unsigned int fShader) {
+  unsigned int program = glCreateProgram();
+  glAttachShader(program, vShader);
+  glAttachShader(program, fShader);
+  glLinkProgram(program);
+
+  glDeleteShader(vShader);
+  glDeleteShader(fShader);
+  return program;
+}
+
+bool IsProgramLinkComplete(unsigned int program) {
+  if (!Capabilities().parallelShaderCompile) return true;
+
+  int complete = GL_FALSE;
+  glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &complete);
+  return complete == GL_TRUE;
+}
+
+static void PrintShaderLogs(unsigned int program) {
+  unsigned int shaders[2];
+  int count = 0;
+  char infoLog[512];
+
+  glGetAttachedShaders(program, 2, &count, shaders);
+  for (int i = 0; i < count; i++) {
+    int success;
+    glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &success);
+    if (!success) {
+      glGetShaderInfoLog(shaders[i], 512, NULL, infoLog);
+      std::println(stderr, "Failed to compile shader: {}", infoLog);
+    }
+  }
+}
+
+bool CheckProgramLink(unsigned int program) {
+  int success;
+  char infoLog[512];
+
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    PrintShaderLogs(program);
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::println(stderr, "Failed to link program: {}", infoLog);
+    return false;
+  }
+
+  return true;
+}
+
+unsigned int CompileShaderProgram(const char* vShader, const char* fShader) {
+  unsigned int program =
+      StartProgramLink(StartShaderCompile(GL_VERTEX_SHADER, vShader),
+                       StartShaderCompile(GL_FRAGMENT_SHADER, fShader));
+  if (!CheckProgramLink(program)) {
+    glDeleteProgram(program);
+    return 0;
+  }
+
+  return program;
+}
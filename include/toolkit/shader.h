@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+
+// Reads the whole file at `path` into `out`. Returns false if the file
+// could not be opened.
+bool ReadFile(const std::string& path, std::string* out);
+
+// Creates a shader object of `type` and starts compiling `source`. The
+// compile status is not queried, so the driver is free to finish the
+// work in the background.
+unsigned int StartShaderCompile(unsigned int type, const char* source);
+
+// Attaches both shaders to a new program and starts linking it. The
+// shaders are flagged for deletion and go away with the program.
+unsigned int StartProgramLink(unsigned int vShader, unsigned int fShader);
+
+// Returns true once a program started with StartProgramLink can be
+// queried without blocking. Always true when the driver does not expose
+// KHR_parallel_shader_compile.
+bool IsProgramLinkComplete(unsigned int program);
+
+// Queries link status, printing the shader and program info logs on
+// failure. Blocks if the link has not finished yet.
+bool CheckProgramLink(unsigned int program);
+
+// Compiles and links a program, blocking until it is done. Returns 0 on
+// failure.
+unsigned int CompileShaderProgram(const char* vShader, const char* fShader);
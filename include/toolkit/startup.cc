@@ -0,0 +1,85 @@
+#include "startup.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <mutex>
+#include <print>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct PhaseRecord {
+  const char* name;
+  const char* detail;
+  int64_t start;
+  int64_t end;
+  std::thread::id thread;
+};
+
+}  // namespace
+
+// Initialized with the toolkit's other statics, before main() runs.
+static const auto gLaunch = std::chrono::steady_clock::now();
+static const std::thread::id gMainThread = std::this_thread::get_id();
+
+static std::mutex gMutex;
+static std::vector<PhaseRecord> gPhases;
+static int64_t gFirstFrame = -1;
+
+// Nanoseconds since launch.
+static int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - gLaunch)
+      .count();
+}
+
+#ifdef TOOLKIT_TRACE
+StartupPhase::StartupPhase(const char* name, const char* detail)
+    : name_(name), detail_(detail), start_(Now()), zone_(name) {}
+#else
+StartupPhase::StartupPhase(const char* name, const char* detail)
+    : name_(name), detail_(detail), start_(Now()) {}
+#endif
+
+StartupPhase::~StartupPhase() {
+  int64_t end = Now();
+  std::lock_guard lock(gMutex);
+  gPhases.push_back(
+      {name_, detail_, start_, end, std::this_thread::get_id()});
+}
+
+double StartupMilliseconds() { return Now() / 1e6; }
+
+void MarkFirstFrame() {
+  std::lock_guard lock(gMutex);
+  if (gFirstFrame < 0) gFirstFrame = Now();
+}
+
+void PrintStartupReport(FILE* out) {
+  std::lock_guard lock(gMutex);
+  std::vector<PhaseRecord> phases = gPhases;
+  std::ranges::sort(phases, {}, &PhaseRecord::start);
+
+  // Threads are numbered in the order their first phase started.
+  std::vector<std::thread::id> threads = {gMainThread};
+  int64_t busy = 0;
+  std::println(out, "{:>10} {:>10}  {:<8} {}", "start", "took", "thread",
+               "phase");
+  for (const PhaseRecord& phase : phases) {
+    auto it = std::ranges::find(threads, phase.thread);
+    if (it == threads.end()) it = threads.insert(it, phase.thread);
+    size_t index = it - threads.begin();
+    busy += phase.end - phase.start;
+
+    std::println(out, "{:8.2f}ms {:8.2f}ms  {:<8} {} {}", phase.start / 1e6,
+                 (phase.end - phase.start) / 1e6,
+                 index == 0 ? "main" : std::format("worker{}", index),
+                 phase.name, phase.detail ? phase.detail : "");
+  }
+  if (gFirstFrame >= 0) {
+    std::println(out, "First frame at {:.2f} ms; phases add up to {:.2f} ms",
+                 gFirstFrame / 1e6, busy / 1e6);
+  }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+
+#include "profile_scope.h"
+#include "trace.h"
+
+// Times the phases between launch and the first presented frame.
+//
+// STARTUP_PHASE records how long the enclosing block took, from any
+// thread, so work overlapped on job system workers shows up next to the
+// main thread's window and context creation. Times are measured from
+// the toolkit's static initialization, which runs before main(). Phases
+// are also trace zones, so with tracing started early they appear on
+// the trace's timeline too.
+
+// Records one phase. `detail`, e.g. a sample name, is printed after
+// `name`; both must outlive the report.
+class StartupPhase {
+ public:
+  explicit StartupPhase(const char* name, const char* detail = nullptr);
+  ~StartupPhase();
+
+  StartupPhase(const StartupPhase&) = delete;
+  StartupPhase& operator=(const StartupPhase&) = delete;
+
+ private:
+  const char* name_;
+  const char* detail_;
+  int64_t start_;
+#ifdef TOOLKIT_TRACE
+  TraceZone zone_;
+#endif
+};
+
+#define STARTUP_PHASE(...) \
+  StartupPhase PROFILE_SCOPE_CONCAT(startupPhase, __LINE__)(__VA_ARGS__)
+
+// Milliseconds since launch.
+double StartupMilliseconds();
+
+// Records the time of the first presented frame; later calls are
+// ignored.
+void MarkFirstFrame();
+
+// Prints every recorded phase in start order with the thread it ran on,
+// and the time to the first frame.
+void PrintStartupReport(FILE* out = stdout);
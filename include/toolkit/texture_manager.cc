@@ -0,0 +1,266 @@
+#include <glad/glad.h>
+
+#include "texture_manager.h"
+
+#include <algorithm>
+#include <bit>
+#include <print>
+
+constexpr size_t kBytesPerPixel = 4;
+
+static int LevelSize(int size, int level) { return std::max(1, size >> level); }
+
+TextureManager::TextureManager(int slots, size_t slotBytes,
+                               size_t residentBudget)
+    : slotBytes_(slotBytes), budget_(residentBudget), slots_(slots) {
+  for (int i = 0; i < slots; i++) {
+    glGenBuffers(1, &slots_[i].pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slots_[i].pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, slotBytes_, NULL, GL_STREAM_DRAW);
+    freeSlots_.push_back(i);
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  worker_ = std::jthread([this](std::stop_token st) { RunWorker(st); });
+}
+
+TextureId TextureManager::Create(TextureDesc desc) {
+  if (desc.width * kBytesPerPixel > slotBytes_) {
+    std::println(stderr, "Texture rows of {} pixels exceed staging slots",
+                 desc.width);
+    return 0;
+  }
+
+  int fullChain = std::bit_width((unsigned)std::max(desc.width, desc.height));
+  if (desc.levels <= 0 || desc.levels > fullChain) desc.levels = fullChain;
+
+  TextureId id;
+  {
+    // The worker reads descriptions, so growing the table is locked.
+    std::lock_guard lock(mu_);
+    entries_.push_back({});
+    entries_.back().desc = std::move(desc);
+    id = entries_.size();
+  }
+  MakeResident(id);
+  return id;
+}
+
+void TextureManager::MakeResident(TextureId id) {
+  Entry& entry = Get(id);
+  const TextureDesc& desc = entry.desc;
+
+  // Allocate every level without data; nothing is copied until the
+  // staged levels arrive.
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  glGenTextures(1, &entry.name);
+  glBindTexture(GL_TEXTURE_2D, entry.name);
+  entry.bytes = 0;
+  for (int level = 0; level < desc.levels; level++) {
+    int w = LevelSize(desc.width, level), h = LevelSize(desc.height, level);
+    glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, w, h, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, NULL);
+    entry.bytes += w * h * kBytesPerPixel;
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, desc.levels - 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, desc.levels - 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                  GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  entry.generation++;
+  entry.baseLevel = desc.levels;
+  entry.rowsDone.assign(desc.levels, 0);
+  residentBytes_ += entry.bytes;
+  lru_.push_front(id);
+  entry.lru = lru_.begin();
+
+  for (int level = desc.levels - 1; level >= 0; level--) {
+    int w = LevelSize(desc.width, level), h = LevelSize(desc.height, level);
+    size_t rowBytes = w * kBytesPerPixel;
+    int band = std::max<size_t>(1, slotBytes_ / rowBytes);
+    for (int row = 0; row < h; row += band)
+      pending_.push_back(
+          {id, entry.generation, level, row, std::min(band, h - row)});
+  }
+}
+
+void TextureManager::Evict(TextureId id) {
+  Entry& entry = Get(id);
+  glDeleteTextures(1, &entry.name);
+  entry.name = 0;
+  // Queued and in-flight jobs still carry the old generation and are
+  // dropped.
+  entry.generation++;
+  residentBytes_ -= entry.bytes;
+  lru_.erase(entry.lru);
+}
+
+unsigned int TextureManager::Texture(TextureId id) {
+  Entry& entry = Get(id);
+  if (entry.name == 0) {
+    MakeResident(id);
+  } else {
+    lru_.splice(lru_.begin(), lru_, entry.lru);
+  }
+  entry.lastUsedFrame = frame_;
+  // Every level is allocated without data, so until the coarsest one has
+  // been copied the texture would sample undefined texels.
+  if (entry.baseLevel == entry.desc.levels) return 0;
+  return entry.name;
+}
+
+bool TextureManager::IsComplete(TextureId id) const {
+  const Entry& entry = entries_[id - 1];
+  return entry.name != 0 && entry.baseLevel == 0;
+}
+
+void TextureManager::Upload(Slot& slot) {
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+  glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+  slot.mapped = nullptr;
+
+  const Job& job = slot.job;
+  Entry& entry = Get(job.id);
+  if (entry.name == 0 || entry.generation != job.generation) return;
+
+  int w = LevelSize(entry.desc.width, job.level);
+  glBindTexture(GL_TEXTURE_2D, entry.name);
+  glTexSubImage2D(GL_TEXTURE_2D, job.level, 0, job.firstRow, w, job.rows,
+                  GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+
+  entry.rowsDone[job.level] += job.rows;
+  int base = entry.baseLevel;
+  while (base > 0 &&
+         entry.rowsDone[base - 1] == LevelSize(entry.desc.height, base - 1))
+    base--;
+  if (base != entry.baseLevel) {
+    entry.baseLevel = base;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, base);
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void TextureManager::Update() {
+  std::deque<int> filled;
+  {
+    std::lock_guard lock(mu_);
+    filled.swap(filled_);
+  }
+
+  for (int index : filled) {
+    Upload(slots_[index]);
+    inFlightSlots_.push_back(index);
+  }
+
+  // A slot can be rewritten once the GPU has consumed its copy. Checked
+  // with a zero timeout so the frame never waits.
+  std::erase_if(inFlightSlots_, [this](int index) {
+    Slot& slot = slots_[index];
+    if (slot.fence != nullptr) {
+      GLenum status = glClientWaitSync((GLsync)slot.fence, 0, 0);
+      if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        return false;
+      glDeleteSync((GLsync)slot.fence);
+      slot.fence = nullptr;
+    }
+    freeSlots_.push_back(index);
+    return true;
+  });
+
+  std::vector<int> toFill;
+  while (!freeSlots_.empty() && !pending_.empty()) {
+    Job job = pending_.front();
+    pending_.pop_front();
+    Entry& entry = Get(job.id);
+    if (entry.name == 0 || entry.generation != job.generation) continue;
+
+    int index = freeSlots_.back();
+    freeSlots_.pop_back();
+    Slot& slot = slots_[index];
+    slot.job = job;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+    // The fence already guarantees the GPU is done with this slot, so
+    // the map does not need to synchronize.
+    slot.mapped = glMapBufferRange(
+        GL_PIXEL_UNPACK_BUFFER, 0, slotBytes_,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
+            GL_MAP_UNSYNCHRONIZED_BIT);
+    toFill.push_back(index);
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  if (!toFill.empty()) {
+    std::lock_guard lock(mu_);
+    toFill_.insert(toFill_.end(), toFill.begin(), toFill.end());
+    cv_.notify_one();
+  }
+
+  // Only textures untouched this frame can go; the one being drawn is
+  // never pulled out from under the caller.
+  while (residentBytes_ > budget_ && !lru_.empty()) {
+    TextureId victim = lru_.back();
+    if (Get(victim).lastUsedFrame == frame_) break;
+    Evict(victim);
+  }
+
+  frame_++;
+}
+
+void TextureManager::RunWorker(std::stop_token stop) {
+  while (true) {
+    int index;
+    {
+      std::unique_lock lock(mu_);
+      if (!cv_.wait(lock, stop, [this] { return !toFill_.empty(); })) return;
+      index = toFill_.front();
+      toFill_.pop_front();
+    }
+
+    // Descriptions never change once created, but the table may grow
+    // on the render thread, so they are read under the lock.
+    Slot& slot = slots_[index];
+    const Job& job = slot.job;
+    MipSource source;
+    int width, height;
+    {
+      std::lock_guard lock(mu_);
+      const TextureDesc& desc = entries_[job.id - 1].desc;
+      source = desc.source;
+      width = LevelSize(desc.width, job.level);
+      height = LevelSize(desc.height, job.level);
+    }
+    source(job.level, width, height, job.firstRow, job.rows,
+           (unsigned char*)slot.mapped);
+
+    std::lock_guard lock(mu_);
+    filled_.push_back(index);
+  }
+}
+
+void TextureManager::Release() {
+  worker_.request_stop();
+  cv_.notify_all();
+  if (worker_.joinable()) worker_.join();
+
+  for (Slot& slot : slots_) {
+    if (slot.mapped != nullptr) {
+      glBindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.pbo);
+      glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+    if (slot.fence != nullptr) glDeleteSync((GLsync)slot.fence);
+    glDeleteBuffers(1, &slot.pbo);
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  slots_.clear();
+
+  for (Entry& entry : entries_)
+    if (entry.name != 0) glDeleteTextures(1, &entry.name);
+  entries_.clear();
+  lru_.clear();
+  pending_.clear();
+  residentBytes_ = 0;
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fills `rows` rows of RGBA8 pixels of mip `level`, starting at
+// `firstRow`, into `dst`. The level is `width` x `height` pixels and rows
+// are tightly packed. Called on the texture worker thread.
+using MipSource = std::function<void(int level, int width, int height,
+                                     int firstRow, int rows,
+                                     unsigned char* dst)>;
+
+struct TextureDesc {
+  int width = 0;
+  int height = 0;
+  // Number of mip levels, 0 for the full chain.
+  int levels = 0;
+  MipSource source;
+};
+
+// Identifies a texture owned by a TextureManager. 0 is never valid.
+using TextureId = uint32_t;
+
+// Streams textures to the GPU without ever uploading on the render
+// thread's critical path.
+//
+// Pixel data is produced by a worker thread straight into a ring of
+// mapped pixel unpack buffers. Update() hands free buffers to the worker
+// and turns filled ones into glTexSubImage2D calls sourced from the
+// buffer, which return without waiting for the copy. Levels are streamed
+// coarsest first and GL_TEXTURE_BASE_LEVEL follows the finest complete
+// level, so a texture is sampleable as soon as its 1x1 level lands and
+// sharpens over the following frames.
+//
+// Textures not used in the current frame are evicted least recently used
+// first while the resident total is over budget, and stream back in on
+// their next use.
+class TextureManager {
+ public:
+  // `slots` buffers of `slotBytes` each are used for staging. Mip levels
+  // bigger than a slot are uploaded in bands of rows.
+  TextureManager(int slots, size_t slotBytes, size_t residentBudget);
+
+  TextureManager(const TextureManager&) = delete;
+  TextureManager& operator=(const TextureManager&) = delete;
+
+  // Registers a texture and queues its upload. Returns 0 if a single row
+  // of the base level does not fit in a staging slot.
+  TextureId Create(TextureDesc desc);
+
+  // Returns the GL texture to sample from this frame and marks it as
+  // used, or 0 while not even its 1x1 level has landed. Evicted textures
+  // are re-created and start streaming again.
+  unsigned int Texture(TextureId id);
+
+  // True once every level of the texture is on the GPU.
+  bool IsComplete(TextureId id) const;
+
+  // Uploads finished staging slots, recycles slots whose copies are done,
+  // refills the worker and enforces the budget. Call once per frame.
+  void Update();
+
+  // Deletes every GL object. Must be called while the context is still
+  // current.
+  void Release();
+
+  size_t ResidentBytes() const { return residentBytes_; }
+
+ private:
+  struct Job {
+    TextureId id;
+    uint32_t generation;
+    int level;
+    int firstRow;
+    int rows;
+  };
+
+  struct Slot {
+    unsigned int pbo = 0;
+    void* mapped = nullptr;
+    void* fence = nullptr;
+    Job job;
+  };
+
+  struct Entry {
+    TextureDesc desc;
+    unsigned int name = 0;
+    uint32_t generation = 0;
+    size_t bytes = 0;
+    // Finest level with it and all coarser levels complete; `levels` if
+    // none are.
+    int baseLevel = 0;
+    std::vector<int> rowsDone;
+    uint64_t lastUsedFrame = 0;
+    std::list<TextureId>::iterator lru;
+  };
+
+  Entry& Get(TextureId id) { return entries_[id - 1]; }
+  void MakeResident(TextureId id);
+  void Evict(TextureId id);
+  void Upload(Slot& slot);
+  void RunWorker(std::stop_token stop);
+
+  size_t slotBytes_;
+  size_t budget_;
+  size_t residentBytes_ = 0;
+  uint64_t frame_ = 1;
+
+  std::vector<Entry> entries_;
+  // Most recently used first.
+  std::list<TextureId> lru_;
+  std::deque<Job> pending_;
+  std::vector<Slot> slots_;
+  std::vector<int> freeSlots_, inFlightSlots_;
+
+  // Slots handed to the worker and handed back filled.
+  std::mutex mu_;
+  std::condition_variable_any cv_;
+  std::deque<int> toFill_, filled_;
+  std::jthread worker_;
+};
@@ -0,0 +1,294 @@
+#include <glad/glad.h>
+
+#include "trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <string>
+#include <vector>
+
+#ifdef TOOLKIT_TRACE
+
+// Zones each thread can hold per trace; later ones are dropped.
+constexpr size_t kEventsPerThread = 1 << 16;
+// How often the GPU clock offset is re-measured, to follow drift.
+constexpr int64_t kCalibrationIntervalNs = 1'000'000'000;
+
+namespace {
+
+struct TraceEvent {
+  const char* name;
+  int64_t start;
+  int64_t end;
+};
+
+// Zones finished on one thread. Only that thread appends; WriteTrace
+// reads entries below `count`.
+struct ThreadBuffer {
+  uint32_t id;
+  std::string name;
+  std::unique_ptr<TraceEvent[]> events{new TraceEvent[kEventsPerThread]};
+  std::atomic<size_t> count = 0;
+  std::atomic<size_t> dropped = 0;
+  // Trace the entries belong to; a stale buffer is reset on next write.
+  std::atomic<uint64_t> session = 0;
+};
+
+struct PendingGpuZone {
+  const char* name;
+  unsigned int begin;
+  unsigned int end;
+};
+
+}  // namespace
+
+static std::atomic<bool> gEnabled = false;
+static std::atomic<uint64_t> gSession = 0;
+static std::atomic<int64_t> gEpoch = 0;
+
+// Buffers of every thread that ever recorded, kept after threads exit so
+// their zones can still be written.
+static std::mutex gBuffersMutex;
+static std::vector<std::unique_ptr<ThreadBuffer>> gBuffers;
+static thread_local ThreadBuffer* tBuffer = nullptr;
+
+// GPU zones in flight and the clock mapping, touched only on the GL
+// thread.
+static std::deque<PendingGpuZone> gPendingGpu;
+static std::vector<unsigned int> gFreeQueries;
+static ThreadBuffer* gGpuBuffer = nullptr;
+static int64_t gGpuOffset = 0;
+static int64_t gLastCalibration = 0;
+static bool gCalibrated = false;
+
+static int64_t SteadyNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Nanoseconds since StartTrace().
+static int64_t Now() {
+  return SteadyNs() - gEpoch.load(std::memory_order_relaxed);
+}
+
+static ThreadBuffer* RegisterBuffer(const char* name) {
+  std::lock_guard lock(gBuffersMutex);
+  auto buffer = std::make_unique<ThreadBuffer>();
+  buffer->id = gBuffers.size() + 1;
+  buffer->name = name ? name : "Thread " + std::to_string(buffer->id);
+  gBuffers.push_back(std::move(buffer));
+  return gBuffers.back().get();
+}
+
+static ThreadBuffer* ThisThreadBuffer() {
+  if (!tBuffer) tBuffer = RegisterBuffer(nullptr);
+  return tBuffer;
+}
+
+static void Append(ThreadBuffer* buffer, const char* name, int64_t start,
+                   int64_t end) {
+  uint64_t session = gSession.load(std::memory_order_relaxed);
+  if (buffer->session.load(std::memory_order_relaxed) != session) {
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->session.store(session, std::memory_order_release);
+  }
+
+  size_t count = buffer->count.load(std::memory_order_relaxed);
+  if (count == kEventsPerThread) {
+    buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer->events[count] = {name, start, end};
+  buffer->count.store(count + 1, std::memory_order_release);
+}
+
+TraceZone::TraceZone(const char* name)
+    : name_(name),
+      start_(gEnabled.load(std::memory_order_relaxed) ? Now() : -1) {}
+
+TraceZone::~TraceZone() {
+  if (start_ >= 0) Append(ThisThreadBuffer(), name_, start_, Now());
+}
+
+static unsigned int AcquireQuery() {
+  if (gFreeQueries.empty()) {
+    unsigned int query;
+    glGenQueries(1, &query);
+    return query;
+  }
+  unsigned int query = gFreeQueries.back();
+  gFreeQueries.pop_back();
+  return query;
+}
+
+GpuTraceZone::GpuTraceZone(const char* name) : name_(name), begin_(0) {
+  if (!gEnabled.load(std::memory_order_relaxed)) return;
+  begin_ = AcquireQuery();
+  glQueryCounter(begin_, GL_TIMESTAMP);
+}
+
+GpuTraceZone::~GpuTraceZone() {
+  if (begin_ == 0) return;
+  unsigned int end = AcquireQuery();
+  glQueryCounter(end, GL_TIMESTAMP);
+  gPendingGpu.push_back({name_, begin_, end});
+}
+
+// Maps GPU timestamps onto Now() by sampling both clocks back to back.
+static void Calibrate() {
+  int64_t now = Now();
+  if (gCalibrated && now - gLastCalibration < kCalibrationIntervalNs) return;
+
+  GLint64 gpu = 0;
+  glGetInteger64v(GL_TIMESTAMP, &gpu);
+  gGpuOffset = Now() - gpu;
+  gLastCalibration = now;
+  gCalibrated = true;
+}
+
+void CollectGpuTrace() {
+  if (gPendingGpu.empty()) return;
+  if (!gGpuBuffer) gGpuBuffer = RegisterBuffer("GPU");
+  Calibrate();
+
+  // Queries finish in submission order, so stop at the first pending.
+  while (!gPendingGpu.empty()) {
+    PendingGpuZone& zone = gPendingGpu.front();
+    GLint available = 0;
+    glGetQueryObjectiv(zone.end, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) break;
+
+    GLuint64 begin = 0, end = 0;
+    glGetQueryObjectui64v(zone.begin, GL_QUERY_RESULT, &begin);
+    glGetQueryObjectui64v(zone.end, GL_QUERY_RESULT, &end);
+    Append(gGpuBuffer, zone.name, int64_t(begin) + gGpuOffset,
+           int64_t(end) + gGpuOffset);
+
+    gFreeQueries.push_back(zone.begin);
+    gFreeQueries.push_back(zone.end);
+    gPendingGpu.pop_front();
+  }
+}
+
+void ReleaseGpuTrace() {
+  for (const PendingGpuZone& zone : gPendingGpu) {
+    gFreeQueries.push_back(zone.begin);
+    gFreeQueries.push_back(zone.end);
+  }
+  gPendingGpu.clear();
+  if (!gFreeQueries.empty())
+    glDeleteQueries(gFreeQueries.size(), gFreeQueries.data());
+  gFreeQueries.clear();
+  gCalibrated = false;
+}
+
+void StartTrace() {
+  gEpoch.store(SteadyNs(), std::memory_order_relaxed);
+  gSession.fetch_add(1, std::memory_order_relaxed);
+  gCalibrated = false;
+  gEnabled.store(true, std::memory_order_release);
+}
+
+void StopTrace() { gEnabled.store(false, std::memory_order_release); }
+
+bool TraceEnabled() { return gEnabled.load(std::memory_order_relaxed); }
+
+void SetTraceThreadName(const char* name) {
+  ThreadBuffer* buffer = ThisThreadBuffer();
+  std::lock_guard lock(gBuffersMutex);
+  buffer->name = name;
+}
+
+// Writes `text` as a JSON string literal.
+static void PrintJsonString(FILE* out, const std::string& text) {
+  std::print(out, "\"");
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      std::print(out, "\\{}", c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      std::print(out, "\\u{:04x}", c);
+    } else {
+      std::print(out, "{}", c);
+    }
+  }
+  std::print(out, "\"");
+}
+
+bool WriteTrace(const char* path) {
+  FILE* out = std::fopen(path, "w");
+  if (!out) {
+    std::println(stderr, "Failed to open trace file {}.", path);
+    return false;
+  }
+
+  uint64_t session = gSession.load(std::memory_order_relaxed);
+  size_t written = 0, dropped = 0;
+  bool first = true;
+  auto separator = [&] {
+    std::print(out, "{}\n", first ? "" : ",");
+    first = false;
+  };
+
+  std::print(out, "{{\"traceEvents\":[");
+  std::lock_guard lock(gBuffersMutex);
+  for (const std::unique_ptr<ThreadBuffer>& buffer : gBuffers) {
+    if (buffer->session.load(std::memory_order_acquire) != session) continue;
+
+    separator();
+    std::print(out,
+               "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+               "\"tid\":{},\"args\":{{\"name\":",
+               buffer->id);
+    PrintJsonString(out, buffer->name);
+    std::print(out, "}}}}");
+
+    size_t count = buffer->count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++) {
+      const TraceEvent& event = buffer->events[i];
+      separator();
+      std::print(out, "{{\"name\":");
+      PrintJsonString(out, event.name);
+      std::print(out,
+                 ",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},"
+                 "\"dur\":{:.3f}}}",
+                 buffer->id, event.start / 1000.0,
+                 (event.end - event.start) / 1000.0);
+    }
+    written += count;
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  std::print(out, "\n]}}\n");
+  std::fclose(out);
+
+  std::println("Wrote {} trace zones to {}.", written, path);
+  if (dropped > 0) {
+    std::println(stderr, "{} zones were dropped; a thread filled its buffer.",
+                 dropped);
+  }
+  return true;
+}
+
+#else
+
+void StartTrace() {}
+void StopTrace() {}
+bool TraceEnabled() { return false; }
+void SetTraceThreadName(const char*) {}
+void CollectGpuTrace() {}
+void ReleaseGpuTrace() {}
+
+bool WriteTrace(const char*) {
+  std::println(stderr, "Tracing is compiled out; configure with "
+                       "-DTOOLKIT_TRACE=ON.");
+  return false;
+}
+
+#endif
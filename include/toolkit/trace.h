@@ -0,0 +1,87 @@
+#pragma once
+
+// Scoped CPU and GPU tracing, exported as Chrome trace JSON that
+// chrome://tracing and ui.perfetto.dev open.
+//
+// TRACE_ZONE records how long the enclosing block took on the calling
+// thread. Each thread appends finished zones to its own buffer with no
+// locking, costing two clock reads and a store per zone. TRACE_GPU_ZONE
+// brackets GL commands with timestamp queries; CollectGpuTrace() reads
+// finished ones and maps them onto the CPU clock, calibrated with
+// glGetInteger64v(GL_TIMESTAMP), so both appear on one timeline.
+//
+// Zones record only between StartTrace() and StopTrace(). Configuring
+// with -DTOOLKIT_TRACE=OFF compiles the macros to nothing.
+//
+// Zone names must outlive the trace; string literals are the norm.
+
+// Begins recording, discarding anything recorded before.
+void StartTrace();
+
+// Stops recording; recorded zones are kept for WriteTrace().
+void StopTrace();
+
+bool TraceEnabled();
+
+// Names the calling thread in the exported trace.
+void SetTraceThreadName(const char* name);
+
+// Moves finished GPU zones into the trace. Call once per frame on the
+// thread that owns the GL context.
+void CollectGpuTrace();
+
+// Deletes the GPU zones' queries. Must be called while the context is
+// still current.
+void ReleaseGpuTrace();
+
+// Writes every recorded zone to `path` as Chrome trace JSON. Returns
+// false if the file cannot be written or tracing is compiled out.
+bool WriteTrace(const char* path);
+
+#ifdef TOOLKIT_TRACE
+
+#include <cstdint>
+
+// Records the lifetime of a block on the calling thread.
+class TraceZone {
+ public:
+  explicit TraceZone(const char* name);
+  ~TraceZone();
+
+  TraceZone(const TraceZone&) = delete;
+  TraceZone& operator=(const TraceZone&) = delete;
+
+ private:
+  const char* name_;
+  // Start time, or -1 when tracing was off at construction.
+  int64_t start_;
+};
+
+// Records when the GPU executes the GL commands issued in a block.
+class GpuTraceZone {
+ public:
+  explicit GpuTraceZone(const char* name);
+  ~GpuTraceZone();
+
+  GpuTraceZone(const GpuTraceZone&) = delete;
+  GpuTraceZone& operator=(const GpuTraceZone&) = delete;
+
+ private:
+  const char* name_;
+  // Query marking the start, 0 when tracing was off at construction.
+  unsigned int begin_;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#define TRACE_ZONE(name) TraceZone TRACE_CONCAT(traceZone, __LINE__)(name)
+#define TRACE_GPU_ZONE(name) \
+  GpuTraceZone TRACE_CONCAT(gpuTraceZone, __LINE__)(name)
+
+#else
+
+#define TRACE_ZONE(name) static_cast<void>(0)
+#define TRACE_GPU_ZONE(name) static_cast<void>(0)
+
+#endif
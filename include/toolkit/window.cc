@@ -2,15 +2,38 @@
 
 #include "window.h"
 
-void InitGLFW(int major, int minor, int prof) {
+#include <chrono>
+#include <print>
+
+#include "debug_output.h"
+
+static double loadMilliseconds = 0;
+static bool debugContext = false;
+
+void InitGLFW(int major, int minor, int prof, bool debug) {
   glfwInit();
   glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
   glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
   glfwWindowHint(GLFW_OPENGL_PROFILE, prof);
+  glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, debug ? GLFW_TRUE : GLFW_FALSE);
+  debugContext = debug;
 
 #if defined(__APPLE__)
   glfwWindowHint(GLFW_OPENGL_FORWARD_COMPACT, GL_TRUE);
 #endif
 }
 
-bool InitGLAD() { return gladLoadGLLoader((GLADloadproc)glfwGetProcAddress); }
+bool InitGLAD(bool lazy) {
+  auto start = std::chrono::steady_clock::now();
+  int loaded = lazy ? gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)
+                    : gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+  loadMilliseconds = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+  if (loaded && debugContext && !InstallDebugOutput())
+    std::println(stderr, "GL debug output is not available.");
+  return loaded;
+}
+
+LoaderStats GetLoaderStats() { return {loadMilliseconds, gladGLLookups}; }
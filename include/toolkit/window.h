@@ -3,8 +3,23 @@
 #include <stdbool.h>
 
 // Initializes GLFW and sets appropriate OpenGL Version and Profile
-// hints.
-void InitGLFW(int glVersionMajor, int glVersionMinor, int profile);
+// hints. With `debug`, a debug context is requested and InitGLAD installs
+// the GL debug message callback (see debug_output.h).
+void InitGLFW(int glVersionMajor, int glVersionMinor, int profile,
+              bool debug = false);
 
-// Initializes GLAD
-bool InitGLAD();
+// How long the last InitGLAD call took and how many GL symbols have been
+// looked up since. In lazy mode the lookup count keeps growing as entry
+// points are called for the first time.
+struct LoaderStats {
+  double milliseconds;
+  unsigned int lookups;
+};
+
+// Initializes GLAD. With `lazy`, entry points are resolved on their
+// first call instead of all up front; that first call may come from any
+// thread with a shared context current, so stubs publish the resolved
+// pointer atomically.
+bool InitGLAD(bool lazy = false);
+
+LoaderStats GetLoaderStats();
@@ -0,0 +1,141 @@
+#include <glad/glad.h>
+
+#include "window_group.h"
+
+#include <GLFW/glfw3.h>
+
+#include <chrono>
+#include <format>
+#include <print>
+
+#include "trace.h"
+
+// Nanoseconds on a monotonic clock.
+static int64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+WindowGroup::~WindowGroup() {
+  if (!windows_.empty())
+    std::println(stderr, "WindowGroup destroyed without Stop().");
+}
+
+bool WindowGroup::Start(GLFWwindow* shared, int count, int width, int height,
+                        bool visible, int swapInterval, Callbacks callbacks) {
+  callbacks_ = std::move(callbacks);
+  swapInterval_ = swapInterval;
+
+  glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+  for (int i = 0; i < count; i++) {
+    std::string title = std::format("Window {}", i + 1);
+    GLFWwindow* handle =
+        glfwCreateWindow(width, height, title.c_str(), NULL, shared);
+    if (handle == NULL) {
+      std::println(stderr, "Failed to create window {} of {}.", i + 1, count);
+      break;
+    }
+    auto window = std::make_unique<Window>();
+    window->handle = handle;
+    int fbWidth, fbHeight;
+    glfwGetFramebufferSize(handle, &fbWidth, &fbHeight);
+    window->width = fbWidth;
+    window->height = fbHeight;
+    glfwSetWindowUserPointer(handle, window.get());
+    glfwSetFramebufferSizeCallback(handle, ResizeCallback);
+    windows_.push_back(std::move(window));
+  }
+  glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+  // Threads start once every window exists so none of them races the
+  // creation of the next.
+  lastStats_ = glfwGetTime();
+  for (int i = 0; i < Count(); i++) {
+    windows_[i]->thread =
+        std::jthread([this, i](std::stop_token stop) { Present(i, stop); });
+  }
+  return !windows_.empty();
+}
+
+void WindowGroup::Stop() {
+  for (auto& window : windows_) window->thread.request_stop();
+  for (auto& window : windows_) {
+    if (window->thread.joinable()) window->thread.join();
+    glfwDestroyWindow(window->handle);
+  }
+  windows_.clear();
+}
+
+std::vector<WindowStats> WindowGroup::TakeStats() {
+  double now = glfwGetTime();
+  double elapsed = now - lastStats_;
+  lastStats_ = now;
+
+  std::vector<WindowStats> stats;
+  for (auto& window : windows_) {
+    uint64_t frames = window->frames.load(std::memory_order_relaxed);
+    int64_t render = window->renderNanos.load(std::memory_order_relaxed);
+    int64_t swap = window->swapNanos.load(std::memory_order_relaxed);
+
+    WindowStats& out = stats.emplace_back();
+    out.frames = frames - window->lastFrames;
+    if (out.frames > 0) {
+      out.fps = elapsed > 0 ? out.frames / elapsed : 0;
+      out.renderMs = (render - window->lastRenderNanos) / 1e6 / out.frames;
+      out.swapMs = (swap - window->lastSwapNanos) / 1e6 / out.frames;
+    }
+    window->lastFrames = frames;
+    window->lastRenderNanos = render;
+    window->lastSwapNanos = swap;
+  }
+  return stats;
+}
+
+void WindowGroup::Present(int index, std::stop_token stop) {
+  Window& window = *windows_[index];
+  glfwMakeContextCurrent(window.handle);
+  // Each window waits for its own display only.
+  glfwSwapInterval(swapInterval_);
+  std::string name = std::format("Window {}", index + 1);
+  SetTraceThreadName(name.c_str());
+
+  bool ok = !callbacks_.init || callbacks_.init(index);
+  double start = glfwGetTime();
+  int width = 0, height = 0;
+  while (ok && !stop.stop_requested() &&
+         !glfwWindowShouldClose(window.handle)) {
+    int64_t frameStart = Now();
+    int w = window.width.load(std::memory_order_relaxed);
+    int h = window.height.load(std::memory_order_relaxed);
+    if (w != width || h != height) {
+      width = w;
+      height = h;
+      glViewport(0, 0, width, height);
+    }
+    {
+      TRACE_ZONE("Render");
+      callbacks_.render(index, glfwGetTime() - start, width, height);
+    }
+    int64_t swapStart = Now();
+    {
+      TRACE_ZONE("Swap");
+      glfwSwapBuffers(window.handle);
+    }
+    int64_t end = Now();
+
+    window.renderNanos.fetch_add(swapStart - frameStart,
+                                 std::memory_order_relaxed);
+    window.swapNanos.fetch_add(end - swapStart, std::memory_order_relaxed);
+    window.frames.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (callbacks_.release) callbacks_.release(index);
+  glfwMakeContextCurrent(NULL);
+}
+
+void WindowGroup::ResizeCallback(GLFWwindow* handle, int width, int height) {
+  auto* window = static_cast<Window*>(glfwGetWindowUserPointer(handle));
+  window->width.store(width, std::memory_order_relaxed);
+  window->height.store(height, std::memory_order_relaxed);
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct GLFWwindow;
+
+// Frame rate of one window over the interval since the last
+// WindowGroup::TakeStats() call.
+struct WindowStats {
+  uint64_t frames = 0;
+  double fps = 0;
+  // Average time per frame spent rendering and in glfwSwapBuffers.
+  double renderMs = 0;
+  double swapMs = 0;
+};
+
+// Extra windows whose contexts share objects with an existing one, each
+// rendered and presented by its own thread.
+//
+// Every window swaps with its own swap interval on its own thread, so a
+// window whose glfwSwapBuffers blocks, on a slow or differently timed
+// display, only holds back itself. Buffers, textures and programs are
+// shared; vertex arrays, framebuffers and current vertex attribute
+// values are per context, so `init` creates per-window objects and
+// per-window constants are best passed as vertex attribute values
+// rather than uniforms, which live in the shared program.
+//
+// Shared objects must be complete (e.g. glFinish or a fence waited on)
+// before Start(), and must not be modified while the windows run.
+class WindowGroup {
+ public:
+  struct Callbacks {
+    // Runs on the window's thread once its context is current. Returning
+    // false closes the window.
+    std::function<bool(int index)> init;
+    // Draws one frame of window `index` into its default framebuffer,
+    // whose viewport is already set to `width` x `height`.
+    std::function<void(int index, double time, int width, int height)>
+        render;
+    // Runs on the window's thread before its context goes away.
+    std::function<void(int index)> release;
+  };
+
+  WindowGroup() = default;
+  ~WindowGroup();
+
+  WindowGroup(const WindowGroup&) = delete;
+  WindowGroup& operator=(const WindowGroup&) = delete;
+
+  // Creates `count` windows sharing objects with `shared` and starts a
+  // present thread for each, presenting with `swapInterval`. Call on the
+  // main thread, which must keep polling events while the group runs.
+  // Returns false if no window could be created.
+  bool Start(GLFWwindow* shared, int count, int width, int height,
+             bool visible, int swapInterval, Callbacks callbacks);
+
+  // Stops the threads and destroys the windows. Call on the main thread.
+  void Stop();
+
+  int Count() const { return windows_.size(); }
+
+  // Per-window statistics since the previous call.
+  std::vector<WindowStats> TakeStats();
+
+ private:
+  struct Window {
+    GLFWwindow* handle = nullptr;
+    // Written by the main thread's size callback, read by the present
+    // thread.
+    std::atomic<int> width = 0, height = 0;
+    std::atomic<uint64_t> frames = 0;
+    std::atomic<int64_t> renderNanos = 0, swapNanos = 0;
+    // Values at the previous TakeStats().
+    uint64_t lastFrames = 0;
+    int64_t lastRenderNanos = 0, lastSwapNanos = 0;
+    std::jthread thread;
+  };
+
+  void Present(int index, std::stop_token stop);
+  static void ResizeCallback(GLFWwindow* window, int width, int height);
+
+  Callbacks callbacks_;
+  int swapInterval_ = 1;
+  std::vector<std::unique_ptr<Window>> windows_;
+  double lastStats_ = 0;
+};
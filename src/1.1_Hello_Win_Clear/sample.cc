@@ -0,0 +1,22 @@
+#include <glad/glad.h>
+
+#include <toolkit/application.h>
+
+namespace {
+
+// Clears the window to a solid color.
+class HelloWinClear : public Application {
+ public:
+  bool Init() override { return true; }
+
+  void Render(double) override {
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+  }
+
+  void Release() override {}
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(HelloWinClear, "1.1_Hello_Win_Clear", "Hello World");
@@ -0,0 +1,98 @@
+#include <glad/glad.h>
+
+#include <iterator>
+#include <toolkit/application.h>
+#include <toolkit/shader.h>
+
+namespace {
+
+/*
+ * Vertex Data
+ */
+// clang-format off
+const float kVertices[] = {
+  // Left Triangle
+  -0.8, -0.5, 0.0, // Left
+  0.0, -0.5, 0.0, // Right
+  -0.4, 0.5, 0.0,  // Top
+  // Right Triangle
+  0.0, -0.5, 0.0, // Left
+  0.8, -0.5, 0.0, // Right
+  0.4, 0.5, 0.0, // Top
+};
+// clang-format on
+constexpr int kVertexCount = std::size(kVertices) / 3;
+
+/*
+ * Shaders
+ */
+const char* kVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+void main() {
+  gl_Position = vec4(aPos, 1.0);
+}
+)";
+const char* kFragmentShader = R"(
+#version 330 core
+out vec4 color;
+
+void main() {
+  color = vec4(1.0, 0.8, 0.0, 1.0);
+}
+)";
+
+// Two triangles side by side from a single vertex buffer.
+class HelloTriangleExc1 : public Application {
+ public:
+  bool Init() override {
+    program_ = CompileShaderProgram(kVertexShader, kFragmentShader);
+    if (program_ == 0) return false;
+
+    BufferData();
+    return true;
+  }
+
+  void Render(double) override {
+    glClearColor(1.0, 1.0, 1.0, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program_);
+    glBindVertexArray(VAO_);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount);
+    glBindVertexArray(0);
+    glUseProgram(0);
+  }
+
+  void Release() override {
+    glDeleteVertexArrays(1, &VAO_);
+    glDeleteBuffers(1, &VBO_);
+    glDeleteProgram(program_);
+  }
+
+ private:
+  void BufferData() {
+    glGenVertexArrays(1, &VAO_);
+    glGenBuffers(1, &VBO_);
+
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+  }
+
+  unsigned int VBO_ = 0, VAO_ = 0, program_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(HelloTriangleExc1, "1.2_Hello_Triangle_Exc1",
+                "Hello Triangle Exercise 1");
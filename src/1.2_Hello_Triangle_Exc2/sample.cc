@@ -0,0 +1,112 @@
+#include <glad/glad.h>
+
+#include <iterator>
+#include <toolkit/application.h>
+#include <toolkit/shader.h>
+
+namespace {
+
+/*
+ * Vertex Data
+ */
+// clang-format off
+const float kVertices1[] = {
+  -0.8, -0.5, 0.0, // Left
+  0.0, -0.5, 0.0, // Right
+  -0.4, 0.5, 0.0,  // Top
+};
+const float kVertices2[] = {
+  0.0, -0.5, 0.0, // Left
+  0.8, -0.5, 0.0, // Right
+  0.4, 0.5, 0.0, // Top
+};
+// clang-format on
+constexpr int kVertexCount1 = std::size(kVertices1) / 3;
+constexpr int kVertexCount2 = std::size(kVertices2) / 3;
+
+/*
+ * Shaders
+ */
+const char* kVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+void main() {
+  gl_Position = vec4(aPos, 1.0);
+}
+)";
+const char* kFragmentShader = R"(
+#version 330 core
+out vec4 color;
+
+void main() {
+  color = vec4(1.0, 0.8, 0.0, 1.0);
+}
+)";
+
+// The two triangles of exercise 1, each with its own VAO and VBO.
+class HelloTriangleExc2 : public Application {
+ public:
+  bool Init() override {
+    program_ = CompileShaderProgram(kVertexShader, kFragmentShader);
+    if (program_ == 0) return false;
+
+    BufferData();
+    return true;
+  }
+
+  void Render(double) override {
+    glClearColor(1.0, 1.0, 1.0, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program_);
+    glBindVertexArray(VAOs_[0]);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount1);
+
+    glBindVertexArray(VAOs_[1]);
+    glDrawArrays(GL_TRIANGLES, 0, kVertexCount2);
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+  }
+
+  void Release() override {
+    glDeleteVertexArrays(2, VAOs_);
+    glDeleteBuffers(2, VBOs_);
+    glDeleteProgram(program_);
+  }
+
+ private:
+  void BufferData() {
+    glGenVertexArrays(2, VAOs_);
+    glGenBuffers(2, VBOs_);
+
+    glBindVertexArray(VAOs_[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, VBOs_[0]);
+
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices1), kVertices1,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindVertexArray(VAOs_[1]);
+    glBindBuffer(GL_ARRAY_BUFFER, VBOs_[1]);
+
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices2), kVertices2,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+  }
+
+  unsigned int VBOs_[2] = {}, VAOs_[2] = {}, program_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(HelloTriangleExc2, "1.2_Hello_Triangle_Exc2",
+                "Hello Triangle Exercise 2");
@@ -0,0 +1,219 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <print>
+#include <string>
+#include <toolkit/application.h>
+#include <toolkit/deferred_release.h>
+#include <toolkit/draw_queue.h>
+#include <toolkit/file_watcher.h>
+#include <toolkit/gl_object.h>
+#include <toolkit/glsl_preprocessor.h>
+#include <unordered_map>
+
+namespace {
+
+/*
+ * Program Settings
+ */
+const char* kUsage = R"(
+Exit Application by pressing <ESC>.
+
+Switch settings with:
+  C - Shift both triangles to the next pair of colors
+  G - Rebuild the triangles' buffers, recycling the old ones
+)";
+
+/*
+ * Vertex Data
+ */
+// clang-format off
+const float kVertices[] = {
+  -0.8, -0.5, 0.0, // Left 1
+  -0.4, 0.5, 0.0,  // Top 1
+  0.0, -0.5, 0.0, // Right 1 | Left 2
+  0.8, -0.5, 0.0, // Right 2
+  0.4, 0.5, 0.0, // Top 2
+};
+const unsigned int kIndices[] = {
+  0, 1, 2,
+  2, 3, 4,
+};
+// clang-format on
+
+/*
+ * Shader Files
+ */
+const char* kVertexShader = SHADER_DIR "/triangle.vert";
+const char* kFragmentShader = SHADER_DIR "/color.frag";
+
+/*
+ * Shader Variants
+ */
+const ShaderDefines kColors[] = {
+    {{"COLOR", "vec4(1.0, 1.0, 0.0, 1.0)"}},  // yellow
+    {{"COLOR", "vec4(1.0, 0.2, 0.8, 1.0)"}},  // pink
+    {{"COLOR", "vec4(0.2, 0.8, 1.0, 1.0)"}},  // cyan
+    {{"COLOR", "vec4(0.4, 1.0, 0.4, 1.0)"}},  // green
+};
+const int kColorCount = std::size(kColors);
+// About three expanded variants, so cycling through all four evicts.
+const size_t kVariantBudget = 1024;
+
+// Two triangles drawn with two variants of one hot reloaded shader, out
+// of a ShaderVariantCache holding fewer variants than there are colors.
+class MultiShader : public Application {
+ public:
+  // Reading the shader files overlaps context setup; Init() then only
+  // preprocesses what the watcher already holds.
+  bool Preload() override {
+    return watcher_.Watch(kVertexShader) && watcher_.Watch(kFragmentShader);
+  }
+
+  bool Init() override {
+    // Start building the first pair; frames draw once both have linked.
+    for (int i = 0; i < 2; i++) Variant(i);
+    // Rebuilt buffers may still be drawn from by frames in flight.
+    objects_.SetReleaseQueue(ReleaseQueue());
+    BufferData();
+    return true;
+  }
+
+  void Render(double) override {
+    // A saved source invalidates every variant. Each keeps drawing with
+    // its previous program until the rebuild started below has linked.
+    variants_.Update();
+    if (SourcesChanged()) variants_.Invalidate();
+    if (rebuild_) {
+      // The old buffers come back once the GPU is done with them, so
+      // repeated rebuilds stop allocating new storage.
+      objects_.Destroy(VAO_);
+      objects_.Recycle(VBO_, GL_STATIC_DRAW);
+      objects_.Recycle(EBO_, GL_STATIC_DRAW);
+      BufferData();
+      rebuild_ = false;
+    }
+
+    glClearColor(1.0, 0.0, 1.0, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Keep showing the current pair of colors until both of the
+    // requested pair have linked, so pressing C never waits on the
+    // compiler or blanks a triangle.
+    bool ready = true;
+    for (int i = 0; i < 2; i++) ready &= Variant(first_ + i) != 0;
+    if (ready) shown_ = first_;
+
+    for (int i = 0; i < 2; i++) {
+      unsigned int program = Variant(shown_ + i);
+      if (program == 0) continue;
+      queue_.Add({.program = program,
+                  .vertexArray = objects_.Get(VAO_),
+                  .mode = GL_TRIANGLES,
+                  .count = 3,
+                  .indexType = GL_UNSIGNED_INT,
+                  .offset = i * 3 * sizeof(GLuint)});
+    }
+    queue_.Submit();
+
+    objects_.Flush();
+  }
+
+  void Release() override {
+    const DrawQueueStats& stats = queue_.Stats();
+    std::println("Last frame: {} draws, {} program switches ({} unsorted)",
+                 stats.draws, stats.programSwitches,
+                 stats.submissionProgramSwitches);
+
+    objects_.Release();
+    variants_.Clear();
+  }
+
+  void KeyPressed(int key) override {
+    if (key == GLFW_KEY_C) first_ = (first_ + 1) % kColorCount;
+    if (key == GLFW_KEY_G) rebuild_ = true;
+  }
+
+  const char* Usage() const override { return kUsage; }
+
+  std::string Status() override {
+    const DeferredReleaseQueue* queue = ReleaseQueue();
+    return std::format("{} variants cached in {} bytes, {} bytes awaiting "
+                       "release, {} bytes pooled",
+                       variants_.Count(), variants_.Size(),
+                       queue ? queue->DeferredBytes() : 0,
+                       queue ? queue->PooledBytes() : 0);
+  }
+
+ private:
+  void BufferData() {
+    VAO_ = objects_.Create<GLObjectType::kVertexArray>();
+    glBindVertexArray(objects_.Get(VAO_));
+
+    VBO_ = Upload(GL_ARRAY_BUFFER, kVertices, sizeof(kVertices));
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+    EBO_ = Upload(GL_ELEMENT_ARRAY_BUFFER, kIndices, sizeof(kIndices));
+    glBindVertexArray(0);
+  }
+
+  // Binds a buffer holding `data` to `target`, refilling a recycled one
+  // of the same size when there is one.
+  BufferHandle Upload(GLenum target, const void* data, size_t bytes) {
+    BufferHandle buffer = objects_.AcquireBuffer(bytes, GL_STATIC_DRAW);
+    if (buffer) {
+      glBindBuffer(target, objects_.Get(buffer));
+      glBufferSubData(target, 0, bytes, data);
+      return buffer;
+    }
+
+    buffer = objects_.Create<GLObjectType::kBuffer>();
+    glBindBuffer(target, objects_.Get(buffer));
+    glBufferData(target, bytes, data, GL_STATIC_DRAW);
+    objects_.SetBytes(buffer, bytes);
+    return buffer;
+  }
+
+  unsigned int Variant(int color) {
+    return variants_.Get(kVertexShader, kFragmentShader,
+                         kColors[color % kColorCount]);
+  }
+
+  // Returns true if any file a variant was built from changed on disk.
+  bool SourcesChanged() {
+    bool changed = false;
+    std::string unused;
+    for (auto& [path, version] : versions_)
+      changed |= watcher_.Latest(path, &version, &unused);
+    return changed;
+  }
+
+  GLObjectTable objects_;
+  DrawQueue queue_;
+  VertexArrayHandle VAO_;
+  BufferHandle VBO_, EBO_;
+  FileWatcher watcher_;
+  // Watcher version of every file the variants were built from.
+  std::unordered_map<std::string, uint64_t> versions_;
+  // Sources come from the watcher so includes are watched as well.
+  GlslPreprocessor preprocessor_{
+      [this](const std::string& path, std::string* out) {
+        uint64_t version = 0;
+        if (!watcher_.Watch(path) || !watcher_.Latest(path, &version, out))
+          return false;
+        versions_[path] = version;
+        return true;
+      }};
+  ShaderVariantCache variants_{preprocessor_, kVariantBudget};
+  // Color of the first triangle requested, and the one drawn.
+  int first_ = 0, shown_ = 0;
+  bool rebuild_ = false;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(MultiShader, "1.2_Hello_Triangle_Exc3", "Multi Shader");
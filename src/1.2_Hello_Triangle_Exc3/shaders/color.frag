@@ -0,0 +1,10 @@
+#version 330 core
+out vec4 color;
+
+#ifndef COLOR
+#define COLOR vec4(1.0)
+#endif
+
+void main() {
+  color = COLOR;
+}
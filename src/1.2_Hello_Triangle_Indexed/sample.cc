@@ -0,0 +1,328 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <iterator>
+#include <string>
+#include <toolkit/application.h>
+#include <toolkit/shader.h>
+#include <vector>
+
+namespace {
+
+/*
+ * Program Settings
+ */
+// FILL and LINE draw with glPolygonMode; WIRE and OVERLAY draw filled
+// triangles whose fragment shader paints the edges from barycentric
+// coordinates, which antialiases them and needs no second pass to draw
+// lines over the fill.
+enum DrawMode { FILL, LINE, WIRE, OVERLAY, kDrawModes };
+// Bench labels: every draw mode on the quad, then on the dense grid.
+const char* kModeNames[] = {"fill",       "line",       "wire",
+                            "overlay",    "dense fill", "dense line",
+                            "dense wire", "dense overlay"};
+const float kLineWidth = 1.5;  // pixels
+// Cells per side of the dense grid, so 2 * 512 * 512 triangles, fewer
+// if the driver's buffer textures cannot hold that many indices.
+const int kDenseCells = 512;
+const char* kUsage = R"(
+Exit Application by pressing <ESC>.
+
+Switch settings with:
+  M - Cycle Draw mode between Fill, Line (glPolygonMode), Wire and
+      Fill with Wire overlay (barycentric)
+  D - Toggle between the quad and a dense grid over the same area
+
+Run with --bench to time every mode on both meshes.
+)";
+
+/*
+ * Vertex Data
+ */
+const float kVertices[] = {
+    -0.5, -0.5, 0.0,  // bottom left
+    -0.5, 0.5,  0.0,  // top left
+    0.5,  0.5,  0.0,  // top right
+    0.5,  -0.5, 0.0,  // bottom right
+};
+
+const unsigned int kIndices[] = {
+    0, 1, 2,  // left triangle
+    3, 0, 2,  // right triangle
+};
+
+/*
+ * Shaders
+ */
+const char* kVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos;
+
+void main() {
+  gl_Position = vec4(aPos, 1.0);
+}
+)";
+const char* kFragmentShader = R"(
+#version 330 core
+out vec4 color;
+
+void main() {
+  color = vec4(0.5, 0.3, 0.1, 1.0);
+}
+)";
+
+// Drawn with glDrawArrays over the index count, so gl_VertexID walks the
+// triangles corner by corner: it picks the index to pull the position
+// for, and its remainder by 3 picks the corner's barycentric coordinate.
+// Shared vertices get a different coordinate in every triangle, which
+// per-vertex attributes could not give them.
+const char* kWireVertexShader = R"(
+#version 330 core
+uniform samplerBuffer uPositions;
+uniform usamplerBuffer uIndices;
+
+out vec3 vBarycentric;
+
+void main() {
+  int index = int(texelFetch(uIndices, gl_VertexID).r);
+  vec3 pos = vec3(texelFetch(uPositions, index * 3).r,
+                  texelFetch(uPositions, index * 3 + 1).r,
+                  texelFetch(uPositions, index * 3 + 2).r);
+  int corner = gl_VertexID % 3;
+  vBarycentric = vec3(corner == 0, corner == 1, corner == 2);
+  gl_Position = vec4(pos, 1.0);
+}
+)";
+// A fragment is on an edge where one barycentric coordinate is near 0.
+// fwidth() turns the line width from pixels into barycentric units, and
+// smoothstep() over that width gives the antialiased falloff. Colors are
+// premultiplied, so a transparent fill leaves only the wire.
+const char* kWireFragmentShader = R"(
+#version 330 core
+in vec3 vBarycentric;
+out vec4 color;
+
+uniform vec4 uFillColor;
+uniform vec4 uLineColor;
+uniform float uLineWidth;
+
+void main() {
+  vec3 width = fwidth(vBarycentric) * uLineWidth;
+  vec3 inside = smoothstep(vec3(0.0), width, vBarycentric);
+  float edge = 1.0 - min(min(inside.x, inside.y), inside.z);
+  color = mix(uFillColor, uLineColor, edge);
+  if (color.a == 0.0) discard;
+}
+)";
+
+class HelloTriangleIndexed : public Application {
+ public:
+  bool Init() override {
+    program_ = CompileShaderProgram(kVertexShader, kFragmentShader);
+    if (program_ == 0) return false;
+    wireProgram_ =
+        CompileShaderProgram(kWireVertexShader, kWireFragmentShader);
+    if (wireProgram_ == 0) return false;
+
+    // The wire vertex shader fetches every index, and three floats per
+    // vertex, from buffer textures.
+    int maxTexels = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+    denseCells_ = std::min<int>(kDenseCells, std::sqrt(maxTexels / 6.0));
+
+    BufferData();
+    BufferTextures();
+    return true;
+  }
+
+  void Render(double) override {
+    glClearColor(1.0, 1.0, 1.0, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    if (mode_ == WIRE || mode_ == OVERLAY) {
+      DrawBarycentric();
+      return;
+    }
+    glPolygonMode(GL_FRONT_AND_BACK, mode_ == LINE ? GL_LINE : GL_FILL);
+    glUseProgram(program_);
+    glBindVertexArray(VAO_);
+    glDrawElements(GL_TRIANGLES, indexCount_, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+  }
+
+  void Release() override {
+    glDeleteTextures(1, &positionTexture_);
+    glDeleteTextures(1, &indexTexture_);
+    glDeleteVertexArrays(1, &VAO_);
+    glDeleteBuffers(1, &VBO_);
+    glDeleteBuffers(1, &EBO_);
+    glDeleteProgram(program_);
+    glDeleteProgram(wireProgram_);
+  }
+
+  void KeyPressed(int key) override {
+    if (key == GLFW_KEY_M) mode_ = DrawMode((mode_ + 1) % kDrawModes);
+    if (key == GLFW_KEY_D) SetDense(!dense_);
+  }
+
+  const char* Usage() const override { return kUsage; }
+
+  std::string Status() override {
+    return std::format("{} triangles", indexCount_ / 3);
+  }
+
+  // Compares the glPolygonMode paths against the barycentric ones. Two
+  // triangles measure little beyond per-draw overhead, so each mode is
+  // also run on the dense grid.
+  int BenchModes() const override { return 2 * kDrawModes; }
+  const char* SetBenchMode(int mode) override {
+    mode_ = DrawMode(mode % kDrawModes);
+    SetDense(mode >= kDrawModes);
+    return kModeNames[mode];
+  }
+
+ private:
+  void BufferData() {
+    // Generate objects
+    glGenVertexArrays(1, &VAO_);
+    glGenBuffers(1, &VBO_);
+    glGenBuffers(1, &EBO_);
+
+    // Bind objects
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 3,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    UploadMesh(kVertices, sizeof(kVertices), kIndices, std::size(kIndices));
+  }
+
+  // Replaces the contents of the vertex and index buffers. The buffer
+  // textures view the same buffer objects, so they follow along.
+  void UploadMesh(const float* vertices, size_t vertexBytes,
+                  const unsigned int* indices, size_t indexCount) {
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glBufferData(GL_ARRAY_BUFFER, vertexBytes, vertices, GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(unsigned int),
+                 indices, GL_STATIC_DRAW);
+    indexCount_ = indexCount;
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+  }
+
+  // Switches between the quad and the dense grid.
+  void SetDense(bool dense) {
+    if (dense == dense_) return;
+    dense_ = dense;
+    if (!dense) {
+      UploadMesh(kVertices, sizeof(kVertices), kIndices,
+                 std::size(kIndices));
+      return;
+    }
+
+    std::vector<float> vertices;
+    std::vector<unsigned int> indices;
+    BuildGrid(denseCells_, &vertices, &indices);
+    UploadMesh(vertices.data(), vertices.size() * sizeof(float),
+               indices.data(), indices.size());
+  }
+
+  // Splits the quad into `cells` x `cells` squares, each two triangles
+  // wound like kIndices.
+  static void BuildGrid(int cells, std::vector<float>* vertices,
+                        std::vector<unsigned int>* indices) {
+    for (int y = 0; y <= cells; y++) {
+      for (int x = 0; x <= cells; x++) {
+        vertices->insert(vertices->end(), {-0.5f + float(x) / cells,
+                                           -0.5f + float(y) / cells, 0.0f});
+      }
+    }
+    unsigned int row = cells + 1;
+    for (int y = 0; y < cells; y++) {
+      for (int x = 0; x < cells; x++) {
+        unsigned int bottomLeft = y * row + x;
+        unsigned int topLeft = bottomLeft + row;
+        indices->insert(indices->end(),
+                        {bottomLeft, topLeft, topLeft + 1,  // left
+                         bottomLeft + 1, bottomLeft, topLeft + 1});  // right
+      }
+    }
+  }
+
+  // Views the vertex and index buffers as buffer textures, which the
+  // wireframe vertex shader pulls from.
+  void BufferTextures() {
+    glGenTextures(1, &positionTexture_);
+    glBindTexture(GL_TEXTURE_BUFFER, positionTexture_);
+    // Three-component formats need GL 4.0, so positions are read as
+    // single floats.
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, VBO_);
+
+    glGenTextures(1, &indexTexture_);
+    glBindTexture(GL_TEXTURE_BUFFER, indexTexture_);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, EBO_);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+    glUseProgram(wireProgram_);
+    glUniform1i(glGetUniformLocation(wireProgram_, "uPositions"), 0);
+    glUniform1i(glGetUniformLocation(wireProgram_, "uIndices"), 1);
+    glUniform1f(glGetUniformLocation(wireProgram_, "uLineWidth"), kLineWidth);
+    fillColorLocation_ = glGetUniformLocation(wireProgram_, "uFillColor");
+    lineColorLocation_ = glGetUniformLocation(wireProgram_, "uLineColor");
+    glUseProgram(0);
+  }
+
+  void DrawBarycentric() {
+    glUseProgram(wireProgram_);
+    if (mode_ == OVERLAY) {
+      glUniform4f(fillColorLocation_, 0.5, 0.3, 0.1, 1.0);
+      glUniform4f(lineColorLocation_, 0.1, 0.05, 0.0, 1.0);
+    } else {
+      // Only the antialiased edges cover anything, so blend them in.
+      glUniform4f(fillColorLocation_, 0.0, 0.0, 0.0, 0.0);
+      glUniform4f(lineColorLocation_, 0.5, 0.3, 0.1, 1.0);
+      glEnable(GL_BLEND);
+      glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, positionTexture_);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, indexTexture_);
+    // Core profiles need a vertex array bound; the attributes are unused.
+    glBindVertexArray(VAO_);
+    glDrawArrays(GL_TRIANGLES, 0, indexCount_);
+    glBindVertexArray(0);
+
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glDisable(GL_BLEND);
+    glUseProgram(0);
+  }
+
+  unsigned int VBO_ = 0, VAO_ = 0, EBO_ = 0, program_ = 0;
+  unsigned int wireProgram_ = 0, positionTexture_ = 0, indexTexture_ = 0;
+  int fillColorLocation_ = -1, lineColorLocation_ = -1;
+  DrawMode mode_ = FILL;
+  bool dense_ = false;
+  int denseCells_ = kDenseCells;
+  int indexCount_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(HelloTriangleIndexed, "1.2_Hello_Triangle_Indexed",
+                "Hello Triangle Indexed");
@@ -0,0 +1,259 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <random>
+#include <toolkit/application.h>
+#include <toolkit/gpu_cull.h>
+#include <toolkit/shader.h>
+#include <vector>
+
+namespace {
+
+/*
+ * Scene Properties
+ */
+const size_t kInstanceCount = 200000;
+// Instances are scattered over a square this wide, centered on the origin.
+const float kFieldSize = 2000.0;
+// World units visible from the bottom to the top of the window.
+const float kViewHeight = 100.0;
+// Culling results are a frame or two old, so bounds are widened by more
+// than the camera moves in that time.
+const float kCullPadding = 4.0;
+
+/*
+ * Program Settings
+ */
+const char* kUsage = R"(
+Exit Application by pressing <ESC>.
+
+Switch settings with:
+  C - Toggle GPU culling
+
+Run with --bench to time drawing with and without culling.
+)";
+
+/*
+ * Vertex Data
+ */
+const float kVertices[] = {
+    -1.0, -1.0,  // bottom left
+    1.0,  -1.0,  // bottom right
+    1.0,  1.0,   // top right
+    -1.0, 1.0,   // top left
+};
+
+const unsigned int kIndices[] = {
+    0, 1, 2,  // right triangle
+    2, 3, 0,  // left triangle
+};
+
+/*
+ * Shaders
+ */
+const char* kVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec4 aSphere;
+layout (location = 2) in vec4 aData;
+
+// xy: camera center, zw: half the visible extent.
+uniform vec4 uCamera;
+
+out vec3 vColor;
+
+void main() {
+  vec2 world = aSphere.xy + aPos * aSphere.w * 0.7;
+  gl_Position = vec4((world - uCamera.xy) / uCamera.zw, 0.0, 1.0);
+  vColor = aData.rgb;
+}
+)";
+const char* kFragmentShader = R"(
+#version 330 core
+in vec3 vColor;
+out vec4 color;
+
+void main() {
+  color = vec4(vColor, 1.0);
+}
+)";
+
+class InstancedCulling : public Application {
+ public:
+  // Scattering the instances overlaps context setup.
+  bool Preload() override {
+    std::vector<CullInstance> instances(kInstanceCount);
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> position(-kFieldSize / 2,
+                                                   kFieldSize / 2);
+    std::uniform_real_distribution<float> shade(0.2, 1.0);
+    for (CullInstance& instance : instances) {
+      instance = {{position(rng), position(rng), 0.0},
+                  1.0,
+                  {shade(rng), shade(rng), shade(rng), 1.0}};
+    }
+    auto bytes = reinterpret_cast<const unsigned char*>(instances.data());
+    instanceData_.assign(bytes,
+                         bytes + instances.size() * sizeof(CullInstance));
+    return true;
+  }
+
+  bool Init() override {
+    program_ = CompileShaderProgram(kVertexShader, kFragmentShader);
+    if (program_ == 0) return false;
+    cameraLocation_ = glGetUniformLocation(program_, "uCamera");
+    if (!culler_.Init(kInstanceCount)) return false;
+
+    BufferData();
+    return true;
+  }
+
+  void Render(double time) override {
+    drawn_ += RenderFrame(time);
+    frames_++;
+  }
+
+  void Release() override {
+    culler_.Release();
+    glDeleteVertexArrays(1, &VAO_);
+    glDeleteBuffers(1, &VBO_);
+    glDeleteBuffers(1, &EBO_);
+    glDeleteBuffers(1, &instanceVBO_);
+    glDeleteProgram(program_);
+  }
+
+  void KeyPressed(int key) override {
+    if (key == GLFW_KEY_C) culling_ = !culling_;
+  }
+
+  const char* Usage() const override { return kUsage; }
+
+  std::string Status() override {
+    std::string status = std::format(
+        "{}, {} of {} instances drawn", culling_ ? "culled" : "unculled",
+        frames_ ? drawn_ / frames_ : 0, kInstanceCount);
+    frames_ = 0;
+    drawn_ = 0;
+    return status;
+  }
+
+  // Benchmarks drawing everything against drawing the culled set.
+  int BenchModes() const override { return 2; }
+  const char* SetBenchMode(int mode) override {
+    culling_ = mode == 1;
+    return culling_ ? "culled" : "unculled";
+  }
+
+ private:
+  void BufferData() {
+    glGenVertexArrays(1, &VAO_);
+    glGenBuffers(1, &VBO_);
+    glGenBuffers(1, &EBO_);
+
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices,
+                 GL_STATIC_DRAW);
+
+    // The instances stream in on the loader thread and are drawn from the
+    // first frame after they land.
+    if (Loader()) {
+      instanceUpload_ =
+          Loader()->UploadBuffer(std::move(instanceData_), GL_STATIC_DRAW);
+    } else {
+      glGenBuffers(1, &instanceVBO_);
+      glBindBuffer(GL_ARRAY_BUFFER, instanceVBO_);
+      glBufferData(GL_ARRAY_BUFFER, instanceData_.size(),
+                   instanceData_.data(), GL_STATIC_DRAW);
+    }
+    instanceData_ = {};
+    // Pointed at a buffer per frame in RenderFrame.
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+    glVertexAttribDivisor(1, 1);
+    glVertexAttribDivisor(2, 1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+  }
+
+  // Draws the field as seen at `time` and returns how many instances
+  // were submitted.
+  unsigned int RenderFrame(double time) {
+    int width, height;
+    glfwGetFramebufferSize(Window(), &width, &height);
+    float halfHeight = kViewHeight / 2;
+    float halfWidth = halfHeight * width / std::max(height, 1);
+    float cx = std::cos(time * 0.05) * kFieldSize * 0.3;
+    float cy = std::sin(time * 0.05) * kFieldSize * 0.3;
+
+    if (instanceVBO_ == 0 &&
+        !Loader()->Adopt(instanceUpload_, &instanceVBO_)) {
+      glClearColor(0.1, 0.1, 0.1, 1.0);
+      glClear(GL_COLOR_BUFFER_BIT);
+      return 0;
+    }
+
+    unsigned int buffer = instanceVBO_;
+    unsigned int count = kInstanceCount;
+    if (culling_) {
+      float pad = kCullPadding;
+      const float planes[6][4] = {
+          {1.0, 0.0, 0.0, -(cx - halfWidth - pad)},
+          {-1.0, 0.0, 0.0, cx + halfWidth + pad},
+          {0.0, 1.0, 0.0, -(cy - halfHeight - pad)},
+          {0.0, -1.0, 0.0, cy + halfHeight + pad},
+          // The field is flat, so near and far never reject anything.
+          {0.0, 0.0, 0.0, 1.0},
+          {0.0, 0.0, 0.0, 1.0},
+      };
+      culler_.Cull(instanceVBO_, kInstanceCount, planes);
+      if (!culler_.Result(&buffer, &count)) count = 0;
+    }
+
+    glClearColor(0.1, 0.1, 0.1, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program_);
+    glUniform4f(cameraLocation_, cx, cy, halfWidth, halfHeight);
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(CullInstance),
+                          (void*)0);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(CullInstance),
+                          (void*)offsetof(CullInstance, data));
+    glDrawElementsInstanced(GL_TRIANGLES, std::size(kIndices),
+                            GL_UNSIGNED_INT, 0, count);
+    glBindVertexArray(0);
+    glUseProgram(0);
+
+    return count;
+  }
+
+  unsigned int VAO_ = 0, VBO_ = 0, EBO_ = 0, instanceVBO_ = 0, program_ = 0;
+  int cameraLocation_ = -1;
+  // Filled by Preload() and freed once uploaded.
+  std::vector<unsigned char> instanceData_;
+  UploadId instanceUpload_ = 0;
+  GpuCuller culler_;
+  bool culling_ = true;
+  unsigned long long drawn_ = 0;
+  int frames_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(InstancedCulling, "2.1_Instanced_Culling",
+                "Instanced Culling");
@@ -0,0 +1,213 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <toolkit/application.h>
+#include <toolkit/shader.h>
+#include <toolkit/window_group.h>
+#include <vector>
+
+namespace {
+
+/*
+ * Scene Properties
+ */
+const int kGridSize = 100;
+const int kInstanceCount = kGridSize * kGridSize;
+// Extra windows open at this size, whatever the main window's.
+const int kWindowWidth = 640;
+const int kWindowHeight = 480;
+// How long the first extra window stalls per frame when S is pressed.
+const auto kSlowPresent = std::chrono::milliseconds(50);
+
+/*
+ * Program Settings
+ */
+const char* kUsage = R"(
+Exit Application by pressing <ESC>.
+
+Switch settings with:
+  S - Toggle a 50 ms stall on the first extra window's presents
+
+Run with --windows N for N windows in total.
+)";
+
+/*
+ * Vertex Data
+ */
+const float kVertices[] = {
+    -1.0, -1.0,  // bottom left
+    1.0,  -1.0,  // bottom right
+    1.0,  1.0,   // top right
+    -1.0, -1.0,  // bottom left
+    1.0,  1.0,   // top right
+    -1.0, 1.0,   // top left
+};
+
+/*
+ * Shaders
+ */
+// Attribute 1 is never enabled, so it reads the context's current value
+// set with glVertexAttrib4f. Uniforms would live in the program, which
+// every window shares.
+const char* kVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec2 aPos;
+// x: time, y: hue offset.
+layout (location = 1) in vec4 aView;
+
+out vec3 vColor;
+
+const int kGrid = 100;
+
+void main() {
+  vec2 cell = vec2(gl_InstanceID % kGrid, gl_InstanceID / kGrid);
+  float angle = aView.x + (cell.x + cell.y) * 0.1;
+  mat2 rotate = mat2(cos(angle), sin(angle), -sin(angle), cos(angle));
+  vec2 center = (cell + 0.5) / kGrid * 2.0 - 1.0;
+  gl_Position = vec4(center + rotate * aPos * (0.7 / kGrid), 0.0, 1.0);
+  vColor = 0.5 + 0.5 * cos(6.2832 * (aView.y + cell.x / kGrid +
+                                     vec3(0.0, 0.33, 0.67)));
+}
+)";
+const char* kFragmentShader = R"(
+#version 330 core
+in vec3 vColor;
+out vec4 color;
+
+void main() {
+  color = vec4(vColor, 1.0);
+}
+)";
+
+// One grid of spinning quads drawn into the main window and every extra
+// window, from one shared buffer and program, each window presenting
+// from its own thread.
+class MultiWindow : public Application {
+ public:
+  bool Init() override {
+    program_ = CompileShaderProgram(kVertexShader, kFragmentShader);
+    if (program_ == 0) return false;
+
+    glGenBuffers(1, &VBO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices,
+                 GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    VAO_ = CreateVertexArray();
+    // The other contexts may only read the shared objects once they are
+    // complete.
+    glFinish();
+
+    int extra = WindowCount() - 1;
+    if (extra > 0) {
+      extraVAOs_.resize(extra);
+      groupStarted_ = group_.Start(
+          Window(), extra, kWindowWidth, kWindowHeight, !Headless(),
+          Headless() ? 0 : 1,
+          {.init =
+               [this](int index) {
+                 extraVAOs_[index] = CreateVertexArray();
+                 return true;
+               },
+           .render =
+               [this](int index, double time, int, int) {
+                 if (index == 0 && slow_.load(std::memory_order_relaxed))
+                   std::this_thread::sleep_for(kSlowPresent);
+                 Draw(extraVAOs_[index], time, (index + 1) * 0.2);
+               },
+           .release =
+               [this](int index) {
+                 glDeleteVertexArrays(1, &extraVAOs_[index]);
+               }});
+    }
+    lastStatus_ = glfwGetTime();
+    return true;
+  }
+
+  void Render(double time) override {
+    Draw(VAO_, time, 0.0);
+    frames_++;
+  }
+
+  void Release() override {
+    if (groupStarted_) group_.Stop();
+    groupStarted_ = false;
+    glDeleteVertexArrays(1, &VAO_);
+    glDeleteBuffers(1, &VBO_);
+    glDeleteProgram(program_);
+  }
+
+  void KeyPressed(int key) override {
+    if (key == GLFW_KEY_S) slow_ = !slow_;
+  }
+
+  const char* Usage() const override { return kUsage; }
+
+  // Frame rate of every window and of all of them together.
+  std::string Status() override {
+    double now = glfwGetTime();
+    double mainFps = frames_ / std::max(now - lastStatus_, 1e-9);
+    lastStatus_ = now;
+    frames_ = 0;
+
+    std::string status = std::format("main {:.1f} fps", mainFps);
+    double total = mainFps;
+    std::vector<WindowStats> stats =
+        groupStarted_ ? group_.TakeStats() : std::vector<WindowStats>{};
+    for (size_t i = 0; i < stats.size(); i++) {
+      status += std::format(", #{} {:.1f} fps ({:.2f} + {:.2f} ms swap)",
+                            i + 1, stats[i].fps, stats[i].renderMs,
+                            stats[i].swapMs);
+      total += stats[i].fps;
+    }
+    return status + std::format("; {:.1f} frames/s in total", total);
+  }
+
+ private:
+  // Vertex arrays are not shared, so each context makes its own.
+  unsigned int CreateVertexArray() {
+    unsigned int vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    return vao;
+  }
+
+  // Draws the grid with the calling thread's context.
+  void Draw(unsigned int vao, double time, float hue) {
+    glClearColor(0.1, 0.1, 0.1, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program_);
+    glVertexAttrib4f(1, time, hue, 0.0, 0.0);
+    glBindVertexArray(vao);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, std::size(kVertices) / 2,
+                          kInstanceCount);
+    glBindVertexArray(0);
+    glUseProgram(0);
+  }
+
+  unsigned int VBO_ = 0, VAO_ = 0, program_ = 0;
+  std::vector<unsigned int> extraVAOs_;
+  WindowGroup group_;
+  bool groupStarted_ = false;
+  std::atomic<bool> slow_ = false;
+  int frames_ = 0;
+  double lastStatus_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(MultiWindow, "2.2_Multi_Window", "Multi Window");
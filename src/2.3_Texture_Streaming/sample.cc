@@ -0,0 +1,215 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <toolkit/application.h>
+#include <toolkit/shader.h>
+#include <toolkit/texture_manager.h>
+#include <vector>
+
+namespace {
+
+/*
+ * Scene Properties
+ */
+const int kTextureCount = 64;
+const int kTextureSize = 512;
+// Textures are shown a page of kPageSize x kPageSize at a time.
+const int kPageSize = 4;
+const int kPageTextures = kPageSize * kPageSize;
+const double kPageSeconds = 2.0;
+// Smaller than all textures together, so turning the page evicts.
+const size_t kResidentBudget = 32 << 20;
+const int kStagingSlots = 8;
+const size_t kStagingBytes = 256 << 10;
+
+/*
+ * Program Settings
+ */
+const char* kUsage = R"(
+Exit Application by pressing <ESC>.
+
+Switch settings with:
+  P - Pause or resume turning the page
+)";
+
+/*
+ * Vertex Data
+ */
+const float kVertices[] = {
+    0.0, 0.0,  // bottom left
+    1.0, 0.0,  // bottom right
+    1.0, 1.0,  // top right
+    0.0, 0.0,  // bottom left
+    1.0, 1.0,  // top right
+    0.0, 1.0,  // top left
+};
+
+/*
+ * Shaders
+ */
+const char* kVertexShader = R"(
+#version 330 core
+layout (location = 0) in vec2 aPos;
+
+// xy: bottom-left corner, zw: size, in clip space.
+uniform vec4 uRect;
+
+out vec2 vUv;
+
+void main() {
+  vUv = aPos;
+  gl_Position = vec4(uRect.xy + aPos * uRect.zw, 0.0, 1.0);
+}
+)";
+const char* kFragmentShader = R"(
+#version 330 core
+in vec2 vUv;
+out vec4 color;
+
+uniform sampler2D uTexture;
+
+void main() {
+  color = texture(uTexture, vUv);
+}
+)";
+
+// Checkerboard in a color picked by `texture`. Coarser levels are drawn
+// darker, so levels can be seen sharpening in as they stream.
+void FillPattern(int texture, int level, int width, int firstRow, int rows,
+                 unsigned char* dst) {
+  int cell = std::max(1, width / 8);
+  unsigned char r = 64 + (texture * 37) % 192;
+  unsigned char g = 64 + (texture * 71) % 192;
+  unsigned char b = 64 + (texture * 113) % 192;
+  int shade = 255 - std::min(level * 24, 160);
+  for (int y = firstRow; y < firstRow + rows; y++) {
+    for (int x = 0; x < width; x++) {
+      bool dark = ((x / cell) + (y / cell)) % 2 != 0;
+      int scale = dark ? shade / 2 : shade;
+      *dst++ = r * scale / 255;
+      *dst++ = g * scale / 255;
+      *dst++ = b * scale / 255;
+      *dst++ = 255;
+    }
+  }
+}
+
+// Pages through more textures than fit in the resident budget, all
+// streamed by a TextureManager. Textures whose coarsest level has not
+// landed yet are skipped rather than drawn with undefined texels.
+class TextureStreaming : public Application {
+ public:
+  bool Init() override {
+    program_ = CompileShaderProgram(kVertexShader, kFragmentShader);
+    if (program_ == 0) return false;
+    glUseProgram(program_);
+    glUniform1i(glGetUniformLocation(program_, "uTexture"), 0);
+    rectLocation_ = glGetUniformLocation(program_, "uRect");
+    glUseProgram(0);
+
+    BufferData();
+
+    textures_ = std::make_unique<TextureManager>(kStagingSlots, kStagingBytes,
+                                                 kResidentBudget);
+    for (int i = 0; i < kTextureCount; i++) {
+      TextureDesc desc;
+      desc.width = kTextureSize;
+      desc.height = kTextureSize;
+      desc.source = [i](int level, int width, int, int firstRow, int rows,
+                        unsigned char* dst) {
+        FillPattern(i, level, width, firstRow, rows, dst);
+      };
+      ids_.push_back(textures_->Create(std::move(desc)));
+    }
+    return true;
+  }
+
+  void Render(double time) override {
+    const int pages = kTextureCount / kPageTextures;
+    if (!paused_) page_ = int(time / kPageSeconds) % pages;
+    textures_->Update();
+
+    glClearColor(0.1, 0.1, 0.1, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program_);
+    glBindVertexArray(VAO_);
+    glActiveTexture(GL_TEXTURE0);
+    float size = 2.0f / kPageSize;
+    drawn_ = 0;
+    complete_ = 0;
+    for (int i = 0; i < kPageTextures; i++) {
+      TextureId id = ids_[page_ * kPageTextures + i];
+      unsigned int texture = textures_->Texture(id);
+      if (texture == 0) continue;
+      complete_ += textures_->IsComplete(id);
+      drawn_++;
+
+      float x = -1.0f + (i % kPageSize) * size;
+      float y = -1.0f + (i / kPageSize) * size;
+      glUniform4f(rectLocation_, x + 0.01f, y + 0.01f, size - 0.02f,
+                  size - 0.02f);
+      glBindTexture(GL_TEXTURE_2D, texture);
+      glDrawArrays(GL_TRIANGLES, 0, std::size(kVertices) / 2);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindVertexArray(0);
+    glUseProgram(0);
+  }
+
+  void Release() override {
+    if (textures_) textures_->Release();
+    textures_.reset();
+    ids_.clear();
+    glDeleteVertexArrays(1, &VAO_);
+    glDeleteBuffers(1, &VBO_);
+    glDeleteProgram(program_);
+  }
+
+  void KeyPressed(int key) override {
+    if (key == GLFW_KEY_P) paused_ = !paused_;
+  }
+
+  const char* Usage() const override { return kUsage; }
+
+  std::string Status() override {
+    return std::format("page {}, {} of {} drawn, {} complete, {:.1f} MiB "
+                       "resident",
+                       page_, drawn_, kPageTextures, complete_,
+                       textures_->ResidentBytes() / double(1 << 20));
+  }
+
+ private:
+  void BufferData() {
+    glGenVertexArrays(1, &VAO_);
+    glGenBuffers(1, &VBO_);
+
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 2,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+  }
+
+  unsigned int VBO_ = 0, VAO_ = 0, program_ = 0;
+  int rectLocation_ = -1;
+  std::unique_ptr<TextureManager> textures_;
+  std::vector<TextureId> ids_;
+  int page_ = 0;
+  bool paused_ = false;
+  int drawn_ = 0, complete_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(TextureStreaming, "2.3_Texture_Streaming",
+                "Texture Streaming");
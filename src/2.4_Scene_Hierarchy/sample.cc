@@ -0,0 +1,424 @@
+#include <glad/glad.h>
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <numbers>
+#include <string>
+#include <toolkit/application.h>
+#include <toolkit/file_watcher.h>
+#include <toolkit/hot_program.h>
+#include <toolkit/indirect_draw.h>
+#include <toolkit/math.h>
+#include <toolkit/scene.h>
+#include <vector>
+
+namespace {
+
+/*
+ * Scene Properties
+ */
+// Hubs on a square grid, each with spinning arms that carry leaves:
+// 100 + 900 + 9000 entities over three hierarchy levels.
+const int kHubsPerSide = 10;
+const int kArmsPerHub = 9;
+const int kLeavesPerArm = 10;
+const float kHubSpacing = 10.0;
+const float kArmRadius = 3.0;
+const float kArmScale = 0.4;
+// In arm space, so scaled by kArmScale.
+const float kLeafRadius = 3.0;
+const float kLeafScale = 0.6;
+
+/*
+ * Program Settings
+ */
+const char* kUsage = R"(
+Exit Application by pressing <ESC>.
+
+Switch settings with:
+  F - Freeze or resume the animation
+  M - Cycle instanced, per-object and indirect submission
+
+Run with --bench to time each submission mode.
+)";
+
+enum SubmitMode { INSTANCED, PER_OBJECT, INDIRECT, kSubmitModes };
+const char* kModeNames[kSubmitModes] = {"instanced", "per-object",
+                                        "indirect"};
+
+/*
+ * Vertex Data
+ */
+enum Mesh { HUB, ARM, LEAF, kMeshes };
+
+struct MeshRange {
+  unsigned int firstIndex;
+  unsigned int count;
+};
+
+// clang-format off
+const float kVertices[] = {
+  // hub: hexagon around its center
+   0.0,    0.0,   0.5, 0.5, 0.6,
+   1.0,    0.0,   0.5, 0.5, 0.6,
+   0.5,    0.866, 0.5, 0.5, 0.6,
+  -0.5,    0.866, 0.5, 0.5, 0.6,
+  -1.0,    0.0,   0.5, 0.5, 0.6,
+  -0.5,   -0.866, 0.5, 0.5, 0.6,
+   0.5,   -0.866, 0.5, 0.5, 0.6,
+  // arm: square
+  -0.5,   -0.5,   1.0, 0.6, 0.2,
+   0.5,   -0.5,   1.0, 0.6, 0.2,
+   0.5,    0.5,   1.0, 0.6, 0.2,
+  -0.5,    0.5,   1.0, 0.6, 0.2,
+  // leaf: triangle
+   0.0,    1.0,   0.3, 0.9, 0.8,
+  -0.866, -0.5,   0.3, 0.9, 0.8,
+   0.866, -0.5,   0.3, 0.9, 0.8,
+};
+const unsigned int kIndices[] = {
+  0, 1, 2,  0, 2, 3,  0, 3, 4,  0, 4, 5,  0, 5, 6,  0, 6, 1,
+  7, 8, 9,  9, 10, 7,
+  11, 12, 13,
+};
+// clang-format on
+const MeshRange kMeshRanges[kMeshes] = {{0, 18}, {18, 6}, {24, 3}};
+
+/*
+ * Shader Files
+ */
+const char* kVertexShader = SHADER_DIR "/entity.vert";
+const char* kFragmentShader = SHADER_DIR "/entity.frag";
+
+/*
+ * Shader Variants
+ */
+// Takes the world matrix from a uniform set before each draw instead of
+// an instance attribute.
+const ShaderDefines kPerObject = {{"PER_OBJECT", ""}};
+
+// World matrix columns are attributes 2 to 5.
+const unsigned int kWorldLocation = 2;
+
+const char* PathName(IndirectDrawList::Path path) {
+  switch (path) {
+    case IndirectDrawList::Path::kMultiDrawIndirect:
+      return "multi-draw indirect";
+    case IndirectDrawList::Path::kBaseInstanceLoop:
+      return "base instance loop";
+    default:
+      return "emulated";
+  }
+}
+
+// A field of spinning hubs kept in a Scene. Only hubs and arms are
+// animated; the Scene carries that down to every leaf, level by level,
+// and the world matrices go straight into the instance buffer.
+//
+// The entities can be submitted as one instanced draw per mesh, as one
+// draw per entity with its matrix in a uniform, or as one indirect
+// command per entity sent with a single call, to compare the CPU cost
+// of each.
+class SceneHierarchy : public Application {
+ public:
+  // Building the hierarchy and reading the shaders overlap context
+  // setup.
+  bool Preload() override {
+    BuildScene();
+    return instanced_.hot.Prepare(kVertexShader, kFragmentShader) &&
+           perObject_.hot.Prepare(kVertexShader, kFragmentShader,
+                                  kPerObject);
+  }
+
+  bool Init() override {
+    if (!instanced_.hot.Load() || !perObject_.hot.Load()) return false;
+    BufferData();
+
+    indirect_ = std::make_unique<IndirectDrawList>();
+    std::vector<InstanceAttribute> world;
+    for (unsigned int column = 0; column < 4; column++) {
+      world.push_back({kWorldLocation + column, 4, GL_FLOAT, sizeof(Mat4),
+                       column * 4 * sizeof(float)});
+    }
+    indirect_->SetInstanceAttributes(matrixBuffer_, std::move(world));
+    return true;
+  }
+
+  void Render(double time) override {
+    instanced_.hot.Update();
+    perObject_.hot.Update();
+    if (!frozen_) Animate(time);
+
+    double start = glfwGetTime();
+    scene_.Update();
+    // Per-object draws read the matrices on the CPU. Skipped uploads
+    // add up, so switching back uploads everything that changed since.
+    if (mode_ != PER_OBJECT)
+      scene_.UploadWorldMatrices(GL_ARRAY_BUFFER, matrixBuffer_);
+    updateSeconds_ += glfwGetTime() - start;
+
+    glClearColor(0.1, 0.1, 0.1, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    Program& program = mode_ == PER_OBJECT ? perObject_ : instanced_;
+    UseProgram(program);
+    glBindVertexArray(VAO_);
+    start = glfwGetTime();
+    switch (mode_) {
+      case INSTANCED:
+        draws_ += DrawInstanced();
+        break;
+      case PER_OBJECT:
+        draws_ += DrawPerObject(program.world);
+        break;
+      default:
+        draws_ += DrawIndirect();
+        break;
+    }
+    submitSeconds_ += glfwGetTime() - start;
+    glBindVertexArray(0);
+    glUseProgram(0);
+    frames_++;
+  }
+
+  void Release() override {
+    if (indirect_) indirect_->Release();
+    indirect_.reset();
+    glDeleteVertexArrays(1, &VAO_);
+    glDeleteBuffers(1, &VBO_);
+    glDeleteBuffers(1, &EBO_);
+    glDeleteBuffers(1, &matrixBuffer_);
+    instanced_.hot.Release();
+    perObject_.hot.Release();
+  }
+
+  void KeyPressed(int key) override {
+    if (key == GLFW_KEY_F) frozen_ = !frozen_;
+    if (key == GLFW_KEY_M) mode_ = SubmitMode((mode_ + 1) % kSubmitModes);
+  }
+
+  const char* Usage() const override { return kUsage; }
+
+  std::string Status() override {
+    int frames = std::max(frames_, 1);
+    std::string status = std::format(
+        "{}{}{}, {} entities, update {:.3f} ms, submit {:.3f} ms, {} draw "
+        "calls",
+        kModeNames[mode_], mode_ == INDIRECT ? " via " : "",
+        mode_ == INDIRECT ? PathName(indirect_->path()) : "", scene_.Count(),
+        1000.0 * updateSeconds_ / frames, 1000.0 * submitSeconds_ / frames,
+        draws_ / frames);
+    frames_ = 0;
+    draws_ = 0;
+    updateSeconds_ = submitSeconds_ = 0;
+    return status;
+  }
+
+  int BenchModes() const override { return kSubmitModes; }
+  const char* SetBenchMode(int mode) override {
+    mode_ = SubmitMode(mode);
+    return kModeNames[mode_];
+  }
+
+ private:
+  void BuildScene() {
+    for (int y = 0; y < kHubsPerSide; y++) {
+      for (int x = 0; x < kHubsPerSide; x++) {
+        EntityId hub = scene_.Create();
+        float offset = (kHubsPerSide - 1) * kHubSpacing / 2;
+        scene_.SetPosition(hub, {x * kHubSpacing - offset,
+                                 y * kHubSpacing - offset, 0.0});
+        scene_.SetRenderHandle(hub, HUB);
+        hubs_.push_back(hub);
+      }
+    }
+    for (EntityId hub : hubs_) {
+      for (int a = 0; a < kArmsPerHub; a++) {
+        EntityId arm = scene_.Create(hub);
+        float angle = 2 * std::numbers::pi_v<float> * a / kArmsPerHub;
+        scene_.SetPosition(arm, {kArmRadius * std::cos(angle),
+                                 kArmRadius * std::sin(angle), 0.0});
+        scene_.SetScale(arm, {kArmScale, kArmScale, 1.0});
+        scene_.SetRenderHandle(arm, ARM);
+        arms_.push_back(arm);
+      }
+    }
+    for (EntityId arm : arms_) {
+      for (int l = 0; l < kLeavesPerArm; l++) {
+        EntityId leaf = scene_.Create(arm);
+        float angle = 2 * std::numbers::pi_v<float> * l / kLeavesPerArm;
+        scene_.SetPosition(leaf, {kLeafRadius * std::cos(angle),
+                                  kLeafRadius * std::sin(angle), 0.0});
+        scene_.SetScale(leaf, {kLeafScale, kLeafScale, 1.0});
+        scene_.SetRenderHandle(leaf, LEAF);
+      }
+    }
+  }
+
+  // Turns the hubs one way and the arms the other, at speeds that vary
+  // across the field. Leaves are never touched directly.
+  void Animate(double time) {
+    const Vec3 axis = {0.0, 0.0, 1.0};
+    for (size_t i = 0; i < hubs_.size(); i++) {
+      float speed = 0.2f + 0.05f * (i % 7);
+      scene_.SetRotation(hubs_[i], AxisAngle(time * speed, axis));
+    }
+    for (size_t i = 0; i < arms_.size(); i++) {
+      float speed = 1.0f + 0.1f * (i % 5);
+      scene_.SetRotation(arms_[i], AxisAngle(-time * speed, axis));
+    }
+  }
+
+  void BufferData() {
+    glGenVertexArrays(1, &VAO_);
+    glGenBuffers(1, &VBO_);
+    glGenBuffers(1, &EBO_);
+    glGenBuffers(1, &matrixBuffer_);
+
+    glBindVertexArray(VAO_);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices,
+                 GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 5,
+                          (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(float) * 5,
+                          (void*)(sizeof(float) * 2));
+    glEnableVertexAttribArray(1);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO_);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(kIndices), kIndices,
+                 GL_STATIC_DRAW);
+
+    // Pointed into matrixBuffer_ per draw.
+    for (unsigned int column = 0; column < 4; column++) {
+      glEnableVertexAttribArray(kWorldLocation + column);
+      glVertexAttribDivisor(kWorldLocation + column, 1);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+  }
+
+  // A program and its uniform locations, looked up again after a reload.
+  struct Program {
+    explicit Program(FileWatcher& watcher) : hot(watcher) {}
+
+    HotProgram hot;
+    unsigned int located = 0;
+    int viewProjection = -1;
+    int world = -1;
+  };
+
+  void UseProgram(Program& program) {
+    unsigned int name = program.hot.Program();
+    if (name != program.located) {
+      program.viewProjection = glGetUniformLocation(name, "uViewProjection");
+      program.world = glGetUniformLocation(name, "uWorld");
+      program.located = name;
+    }
+
+    int width, height;
+    glfwGetFramebufferSize(Window(), &width, &height);
+    float half = kHubsPerSide * kHubSpacing / 2;
+    float aspect = float(width) / std::max(height, 1);
+    float halfWidth = aspect >= 1 ? half * aspect : half;
+    float halfHeight = aspect >= 1 ? half : half / aspect;
+    Mat4 viewProjection =
+        Orthographic(-halfWidth, halfWidth, -halfHeight, halfHeight, -1, 1);
+
+    glUseProgram(name);
+    glUniformMatrix4fv(program.viewProjection, 1, GL_FALSE,
+                       viewProjection.m);
+  }
+
+  // Points the world matrix attributes at the matrix of entity `first`
+  // in storage order.
+  void PointWorldMatrices(size_t first) {
+    glBindBuffer(GL_ARRAY_BUFFER, matrixBuffer_);
+    for (unsigned int column = 0; column < 4; column++) {
+      size_t offset = first * sizeof(Mat4) + column * 4 * sizeof(float);
+      glVertexAttribPointer(kWorldLocation + column, 4, GL_FLOAT, GL_FALSE,
+                            sizeof(Mat4), (void*)offset);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+
+  // One instanced draw per run of entities sharing a mesh. Levels are
+  // contiguous and each holds one mesh here, so that is one per level.
+  // Returns the number of draw calls.
+  int DrawInstanced() {
+    const std::vector<uint32_t>& handles = scene_.RenderHandles();
+    int draws = 0;
+    for (size_t begin = 0, end; begin < handles.size(); begin = end) {
+      end = begin + 1;
+      while (end < handles.size() && handles[end] == handles[begin]) end++;
+
+      const MeshRange& mesh = kMeshRanges[handles[begin]];
+      PointWorldMatrices(begin);
+      glDrawElementsInstanced(
+          GL_TRIANGLES, mesh.count, GL_UNSIGNED_INT,
+          (void*)(mesh.firstIndex * sizeof(unsigned int)), end - begin);
+      draws++;
+    }
+    return draws;
+  }
+
+  // The usual way without instancing: set each entity's matrix, then
+  // draw it on its own.
+  int DrawPerObject(int worldLocation) {
+    const std::vector<Mat4>& worlds = scene_.WorldMatrices();
+    const std::vector<uint32_t>& handles = scene_.RenderHandles();
+    for (size_t i = 0; i < handles.size(); i++) {
+      const MeshRange& mesh = kMeshRanges[handles[i]];
+      glUniformMatrix4fv(worldLocation, 1, GL_FALSE, worlds[i].m);
+      glDrawElements(GL_TRIANGLES, mesh.count, GL_UNSIGNED_INT,
+                     (void*)(mesh.firstIndex * sizeof(unsigned int)));
+    }
+    return handles.size();
+  }
+
+  // One command per entity, its base instance selecting its matrix. The
+  // list is refilled on the workers every frame, as a culling pass
+  // would, and sent with one call where the driver has multi-draw
+  // indirect.
+  int DrawIndirect() {
+    const std::vector<uint32_t>& handles = scene_.RenderHandles();
+    indirect_->Fill(handles.size(),
+                    [&](size_t begin, size_t end,
+                        DrawElementsIndirectCommand* commands) {
+                      for (size_t i = begin; i < end; i++) {
+                        const MeshRange& mesh = kMeshRanges[handles[i]];
+                        commands[i] = {mesh.count, 1, mesh.firstIndex, 0,
+                                       uint32_t(i)};
+                      }
+                    });
+    PointWorldMatrices(0);
+    indirect_->Submit(GL_TRIANGLES, GL_UNSIGNED_INT);
+    bool single =
+        indirect_->path() == IndirectDrawList::Path::kMultiDrawIndirect;
+    return single ? 1 : handles.size();
+  }
+
+  unsigned int VAO_ = 0, VBO_ = 0, EBO_ = 0, matrixBuffer_ = 0;
+  FileWatcher watcher_;
+  Program instanced_{watcher_}, perObject_{watcher_};
+  std::unique_ptr<IndirectDrawList> indirect_;
+  SubmitMode mode_ = INSTANCED;
+
+  Scene scene_;
+  std::vector<EntityId> hubs_, arms_;
+  bool frozen_ = false;
+
+  int frames_ = 0;
+  long long draws_ = 0;
+  double updateSeconds_ = 0, submitSeconds_ = 0;
+};
+
+}  // namespace
+
+REGISTER_SAMPLE(SceneHierarchy, "2.4_Scene_Hierarchy", "Scene Hierarchy");
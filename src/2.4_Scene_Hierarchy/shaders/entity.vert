@@ -0,0 +1,22 @@
+#version 330 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec3 aColor;
+
+#ifdef PER_OBJECT
+// Set before each draw.
+uniform mat4 uWorld;
+#define WORLD uWorld
+#else
+// Per instance, straight from Scene::WorldMatrices().
+layout (location = 2) in mat4 aWorld;
+#define WORLD aWorld
+#endif
+
+uniform mat4 uViewProjection;
+
+out vec3 vColor;
+
+void main() {
+  vColor = aColor;
+  gl_Position = uViewProjection * WORLD * vec4(aPos, 0.0, 1.0);
+}
@@ -0,0 +1,5 @@
+#include <toolkit/application.h>
+
+// Runs the samples registered by the object libraries linked in; see
+// RunSamples for the command line.
+int main(int argc, char** argv) { return RunSamples(argc, argv); }